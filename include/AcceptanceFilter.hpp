@@ -0,0 +1,115 @@
+/**
+ * @file AcceptanceFilter.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the CAN ID acceptance filter, which rejects unrelated frames before they are parsed.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_ACCEPTANCEFILTER_HPP
+#define ISOTPP_INCLUDE_ACCEPTANCEFILTER_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "types/CanId.hpp"
+#include "types/ReturnValue.hpp"
+
+namespace isotpp {
+
+    using std::array;
+    using std::atomic;
+    using std::map;
+    using std::mutex;
+    using std::unique_ptr;
+
+    using types::CanId;
+    using types::ReturnValue;
+
+    /**
+     * @brief A compiled set of CAN IDs belonging to active sessions.
+     *
+     * Standard (11-bit) IDs are kept in a 2048-bit bitmap, so checking them is a shift, a load and a mask.
+     * Extended (29-bit) IDs are kept in a fixed-size open-addressing hash table, guarded by a sequence counter.
+     * @see accepts never locks or allocates and is safe to call from any thread while sessions are added or removed.
+     *
+     * IDs are reference counted: a session may add an ID which is already in use by another session,
+     * and the ID is only dropped from the filter once every session using it has removed it.
+     *
+     * @remarks Error and RTR frames are never accepted.
+     * @remarks This class is thread safe!
+     */
+    class AcceptanceFilter {
+        public: // +++ Constants +++
+            static const size_t     DEFAULT_MAX_EXTENDED_IDS = 64; //!< The default amount of distinct extended IDs the filter can hold
+
+        public: // +++ Constructor / Destructor +++
+            explicit                AcceptanceFilter(const size_t maxExtendedIds = DEFAULT_MAX_EXTENDED_IDS);
+            explicit                AcceptanceFilter(const AcceptanceFilter&) = delete; //!< Prevents copy-construction
+            virtual ~               AcceptanceFilter() {}
+
+        public: // +++ Filter maintenance +++
+            ReturnValue             addId(const CanId& canId); //!< Adds a reference to an ID; fails with BUFFER_FULL if the extended table is full
+            void                    removeId(const CanId& canId); //!< Removes a reference to an ID
+            void                    clear(); //!< Removes all IDs
+
+        public: // +++ Filtering +++
+            bool                    accepts(const CanId& canId) const { return accepts(static_cast<uint32_t>(canId)); }
+
+            /**
+             * @brief Determines whether a frame with the given raw ID (including the EFF/RTR/ERR flags) belongs to an active session.
+             */
+            bool                    accepts(const uint32_t rawId) const {
+                if (rawId & (CAN_ERR_FLAG | CAN_RTR_FLAG)) { return false; }
+
+                if (!(rawId & CAN_EFF_FLAG)) {
+                    const uint32_t id = rawId & CAN_SFF_MASK;
+                    return (m_standardIds[id >> 6].load(std::memory_order_relaxed) >> (id & 63)) & 1;
+                }
+
+                if (m_extendedIdCount.load(std::memory_order_relaxed) == 0) { return false; }
+
+                return acceptsExtended(rawId & CAN_EFF_MASK);
+            }
+
+        private: // +++ Internal Functions +++
+            bool                    acceptsExtended(const uint32_t id) const;
+            size_t                  getSlot(const uint32_t id) const { return (id * 0x9e3779b1u) & (m_extendedSlots - 1); }
+            void                    insertExtended(const uint32_t id);
+
+        private:
+            static const uint32_t   SLOT_USED = 0x80000000u; //!< Marks a used hash slot; the rest of the slot holds the 29-bit ID
+
+            array<atomic<uint64_t>, (CAN_SFF_MASK + 1) / 64> m_standardIds;
+
+            atomic<uint32_t>        m_extendedIdCount;
+            atomic<uint32_t>        m_sequence; //!< Odd while the extended table is being modified
+
+            map<uint32_t, uint32_t> m_references; //!< raw ID -> amount of sessions using it
+
+            mutex                   m_lock;
+
+            size_t                  m_extendedSlots; //!< Always a power of two, at least twice the max. amount of extended IDs
+            size_t                  m_maxExtendedIds;
+
+            unique_ptr<atomic<uint32_t>[]> m_extendedIds;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_ACCEPTANCEFILTER_HPP
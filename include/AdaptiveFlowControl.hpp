@@ -0,0 +1,119 @@
+/**
+ * @file AdaptiveFlowControl.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the adaptive flow-control policy, which tunes the BlockSize and STmin advertised to each peer.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_ADAPTIVEFLOWCONTROL_HPP
+#define ISOTPP_INCLUDE_ADAPTIVEFLOWCONTROL_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <map>
+#include <mutex>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "types/CanId.hpp"
+#include "types/FrameFlags.hpp"
+
+namespace isotpp {
+
+    using std::map;
+    using std::mutex;
+
+    using types::CanId;
+    using types::FlowControlFlag;
+
+    /**
+     * @brief The bounds within which the adaptive flow-control policy may tune its parameters.
+     */
+    struct AdaptiveFlowControlConfig {
+        AdaptiveFlowControlConfig(): minBlockSize(1), maxBlockSize(64), minSeparationMicros(0), maxSeparationMicros(127000), targetOccupancy(0.5) {}
+
+        uint8_t             minBlockSize; //!< Must be >= 1; BS 0 (unlimited) would give up control over the buffer. Undercut when fewer frames fit into the buffer
+        uint8_t             maxBlockSize;
+        uint32_t            minSeparationMicros;
+        uint32_t            maxSeparationMicros; //!< At most 127ms, the largest STmin expressible
+        double              targetOccupancy; //!< The share of the receive buffer (0.0 - 1.0) above which the sender is slowed down
+    };
+
+    /**
+     * @brief The values to send in the next flow-control frame.
+     */
+    struct FlowControlParameters {
+        FlowControlFlag     flag; //!< CONTINUE, or WAIT if the buffer cannot take a single frame
+        uint8_t             blockSize;
+        uint8_t             separationTime; //!< The raw STmin byte
+    };
+
+    /**
+     * @brief Tunes the BlockSize and STmin advertised in each FC from what is observed per session.
+     *
+     * The engine reports three measurements per session: how full the receive buffer is, how fast the consumer drains it
+     * and whether frames were lost (sequence errors, N_Cr timeouts). From these the policy derives the next FC:
+     *
+     *  - Blocks completed without loss while the buffer is below its target occupancy grow the block size by one
+     *    and shrink STmin by a quarter (additive increase).
+     *  - A lost frame halves the block size and doubles STmin (multiplicative decrease).
+     *  - Above the target occupancy, STmin is raised so the sender's rate does not exceed the consumer's drain rate.
+     *  - The block size never exceeds the free space in the buffer; without space for a single frame, FC WAIT is sent.
+     *
+     * This way each peer converges to the highest rate the bus and the consumer sustain, within the configured bounds.
+     *
+     * @remarks This class is thread safe!
+     */
+    class AdaptiveFlowControl {
+        public: // +++ Constructor / Destructor +++
+            explicit                AdaptiveFlowControl(const AdaptiveFlowControlConfig& config = AdaptiveFlowControlConfig());
+            explicit                AdaptiveFlowControl(const AdaptiveFlowControl&) = delete; //!< Prevents copy-construction
+            virtual ~               AdaptiveFlowControl() {}
+
+        public: // +++ Measurements +++
+            void                    recordBufferOccupancy(const CanId& session, const size_t bufferedBytes, const size_t capacityBytes);
+            void                    recordConsumed(const CanId& session, const size_t bytes, const uint64_t nowMicros); //!< The consumer took bytes out of the buffer
+            void                    recordBlockCompleted(const CanId& session); //!< A block was received without loss
+            void                    recordFrameLoss(const CanId& session); //!< A frame was lost or arrived out of sequence
+
+            void                    removeSession(const CanId& session);
+
+        public: // +++ Flow control +++
+            FlowControlParameters   getParameters(const CanId& session); //!< Gets the values for the session's next FC
+
+        private: // +++ Internal Types +++
+            /**
+             * @brief The measurements and current parameters of a single session.
+             */
+            struct SessionState {
+                double              blockSize;
+                double              separationMicros;
+                double              drainBytesPerMicro; //!< Exponentially weighted moving average; 0 until measured
+                size_t              bufferedBytes;
+                size_t              capacityBytes;
+                uint64_t            lastConsumedMicros;
+            };
+
+        private: // +++ Internal Functions +++
+            SessionState&           getSession(const CanId& session);
+
+        private:
+            AdaptiveFlowControlConfig m_config;
+
+            map<uint32_t, SessionState> m_sessions;
+
+            mutex                   m_lock;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_ADAPTIVEFLOWCONTROL_HPP
@@ -0,0 +1,132 @@
+/**
+ * @file BatchClassifier.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the batch classifier, which classifies bursts of raw CAN frames with SIMD instructions.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_BATCHCLASSIFIER_HPP
+#define ISOTPP_INCLUDE_BATCHCLASSIFIER_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <functional>
+#include <memory>
+#include <vector>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "AcceptanceFilter.hpp"
+#include "types/FrameType.hpp"
+
+namespace isotpp {
+
+    using std::function;
+    using std::shared_ptr;
+    using std::vector;
+
+    using types::FrameType;
+
+    /**
+     * @brief A raw classic CAN frame.
+     *
+     * The layout matches Linux' struct can_frame, so arrays filled by recvmmsg() or read from a ring can be classified in place.
+     */
+    struct RawCanFrame {
+        uint32_t            canId; //!< The raw ID, including the EFF/RTR/ERR flags
+        uint8_t             length; //!< The amount of valid bytes in data
+        uint8_t             padding[3];
+        uint8_t             data[8];
+    };
+
+    static_assert(sizeof(RawCanFrame) == 16, "RawCanFrame must match the layout of struct can_frame");
+
+    /**
+     * @brief The instruction sets the batch classifier can use.
+     */
+    enum class InstructionSet: uint8_t {
+        SCALAR  = 0,
+        SSE2    = 1,
+        AVX2    = 2
+    };
+
+    /**
+     * @brief A classified batch of frames, stored as a structure of arrays.
+     *
+     * Element i of each array describes frames[i].
+     */
+    struct ClassifiedFrames {
+        const RawCanFrame*  frames;
+        size_t              count;
+
+        vector<uint32_t>    canIds;
+        vector<uint8_t>     frameTypes; //!< The FrameType, BatchClassifier::REJECTED_FRAME for rejected frames, or another value > 3 for reserved types
+        vector<uint8_t>     lowNibbles; //!< The SN of CFs, the flag of FCs and the data length of SFs
+        vector<uint8_t>     continuesRun; //!< Non-zero if the frame is a CF following the previous frame's CF of the same ID in sequence
+        vector<uint16_t>    lengths; //!< The payload length of SFs and CFs, the message length of FFs
+    };
+
+    using cfruncb_t = function<void(const ClassifiedFrames& batch, const size_t first, const size_t count)>; //!< Receives a run of in-sequence CFs of one session
+    using classifiedcb_t = function<void(const ClassifiedFrames& batch, const size_t index)>; //!< Receives a single SF, FF or FC
+
+    /**
+     * @brief Classifies bursts of raw CAN frames without constructing a frame object per frame.
+     *
+     * @see classify gathers the ID and PCI byte of each frame, then splits all PCI bytes into frame type and low nibble
+     * and determines which consecutive frames continue a run of the same session, 16 (SSE2) or 32 (AVX2) frames at a time.
+     * The instruction set is chosen once at construction, from what the CPU supports; other architectures use the scalar path.
+     *
+     * @see ingest additionally dispatches the batch: runs of in-sequence consecutive frames of one session are handed to the
+     * CF run callback as a whole, so reassembly can append them without a per-frame lookup of the session. All other frames
+     * are handed to the frame callback individually. Frames rejected by the acceptance filter and frames of reserved types
+     * are dropped.
+     *
+     * @remarks The classification arrays are reused between batches; after the first batch of the largest size, classifying allocates nothing.
+     * @remarks This class is not thread safe; use one instance per ingest thread.
+     */
+    class BatchClassifier {
+        public: // +++ Constants +++
+            static const uint8_t    REJECTED_FRAME = 0xff; //!< The frame type stored for empty frames and frames rejected by the acceptance filter
+
+        public: // +++ Constructor / Destructor +++
+            explicit                BatchClassifier(const InstructionSet maxInstructionSet = InstructionSet::AVX2);
+            explicit                BatchClassifier(const BatchClassifier&) = delete; //!< Prevents copy-construction
+            virtual ~               BatchClassifier() {}
+
+        public: // +++ Classification +++
+            const ClassifiedFrames& classify(const RawCanFrame* frames, const size_t count); //!< Classifies a batch; the result is valid until the next call
+            size_t                  ingest(const RawCanFrame* frames, const size_t count); //!< Classifies and dispatches a batch; returns the amount of frames dispatched
+
+        public: // +++ Getter / Setter +++
+            BatchClassifier&        setAcceptanceFilter(const shared_ptr<AcceptanceFilter>& val) { m_acceptanceFilter = val; return *this; }
+            BatchClassifier&        setConsecutiveFrameRunCallback(const cfruncb_t& val) { m_cfRunCallback = val; return *this; }
+            BatchClassifier&        setFrameCallback(const classifiedcb_t& val) { m_frameCallback = val; return *this; }
+
+            InstructionSet          getInstructionSet() const { return m_instructionSet; }
+
+        private:
+            cfruncb_t               m_cfRunCallback;
+
+            ClassifiedFrames        m_batch;
+
+            classifiedcb_t          m_frameCallback;
+
+            InstructionSet          m_instructionSet;
+
+            shared_ptr<AcceptanceFilter> m_acceptanceFilter;
+
+            vector<uint8_t>         m_pciBytes;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_BATCHCLASSIFIER_HPP
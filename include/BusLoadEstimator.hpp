@@ -0,0 +1,156 @@
+/**
+ * @file BusLoadEstimator.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the bus-load estimator and the transmit rate limiter built upon it.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_BUSLOADESTIMATOR_HPP
+#define ISOTPP_INCLUDE_BUSLOADESTIMATOR_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <array>
+#include <chrono>
+#include <mutex>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "types/CanId.hpp"
+#include "types/Typedefs.hpp"
+
+namespace isotpp {
+
+    using std::array;
+    using std::chrono::microseconds;
+    using std::mutex;
+
+    using types::CanId;
+
+    /**
+     * @brief The bit count of a single frame on the wire, split by the bitrate it is sent with.
+     */
+    struct FrameBitCount {
+        uint32_t            nominalBits; //!< Bits sent with the nominal (arbitration) bitrate
+        uint32_t            dataBits; //!< Bits sent with the data-phase bitrate. Always 0 for classic CAN and FD frames without BRS.
+    };
+
+    /**
+     * @brief Models the utilisation of a CAN bus.
+     *
+     * The estimator computes the worst-case on-wire time of every frame, including the maximum possible amount of
+     * dynamic stuff bits, the fixed stuff bits of the CAN FD CRC field and the FD data-phase bitrate.
+     * Frames passed to @see recordFrame are accumulated in a sliding window, from which the live utilisation is derived.
+     *
+     * @remarks The nominal bitrate must not be 0; the constructor throws std::invalid_argument otherwise.
+     * @remarks This class is thread safe!
+     */
+    class BusLoadEstimator {
+        public: // +++ Constants +++
+            static const size_t     WINDOW_BUCKETS = 10; //!< The resolution of the sliding utilisation window
+
+        public: // +++ Constructor / Destructor +++
+            explicit                BusLoadEstimator(const uint32_t nominalBitrate = 500000, const uint32_t dataBitrate = 0, const microseconds& window = microseconds(1000000));
+            explicit                BusLoadEstimator(const BusLoadEstimator&) = delete; //!< Prevents copy-construction
+            virtual ~               BusLoadEstimator() {}
+
+        public: // +++ Frame timing +++
+            static FrameBitCount    getFrameBitCount(const CanId& canId, const uint8_t dataLength, const bool canFd = false, const bool bitRateSwitch = false);
+            static uint8_t          getFdFrameLength(const uint8_t dataLength); //!< Rounds a length up to the next valid CAN FD frame length
+
+            uint64_t                getFrameTimeNanos(const CanId& canId, const uint8_t dataLength, const bool canFd = false, const bool bitRateSwitch = false) const;
+
+        public: // +++ Utilisation +++
+            void                    recordFrame(const uint64_t frameTimeNanos, const uint64_t nowMicros); //!< Adds a frame's bus time to the utilisation window
+            double                  getUtilisation(const uint64_t nowMicros); //!< Gets the bus utilisation (0.0 - 1.0) within the last window
+
+            uint64_t                getTotalFrames(); //!< Gets the amount of frames recorded since construction
+            uint64_t                getTotalBusTimeNanos(); //!< Gets the bus time consumed by all frames recorded since construction
+
+        public: // +++ Getter / Setter +++
+            uint32_t                getNominalBitrate() const { return m_nominalBitrate; }
+            uint32_t                getDataBitrate() const { return m_dataBitrate; }
+
+        private: // +++ Internal Types +++
+            /**
+             * @brief A slice of the sliding utilisation window.
+             */
+            struct WindowBucket {
+                uint64_t            epoch; //!< The absolute index of the slice this bucket currently holds
+                uint64_t            busTimeNanos;
+            };
+
+        private:
+            array<WindowBucket, WINDOW_BUCKETS> m_window;
+
+            mutex                   m_lock;
+
+            uint32_t                m_dataBitrate;
+            uint32_t                m_nominalBitrate;
+
+            uint64_t                m_bucketMicros;
+            uint64_t                m_totalBusTimeNanos;
+            uint64_t                m_totalFrames;
+    };
+
+    /**
+     * @brief Token-bucket limiter capping the share of bus bandwidth used for transmission.
+     *
+     * The bucket is refilled with bus time at the configured share of wall-clock time, e.g. a share of 0.3 grants
+     * 300us of bus time per millisecond. Every frame granted by @see tryAcquire is charged with its worst-case bus
+     * time; once the send was attempted, @see commit records the frame in the limiter's @see BusLoadEstimator,
+     * or refunds its bus time if the bus did not take it.
+     *
+     * @remarks The bucket may go into debt by at most one frame, so frames longer than the burst size are never starved.
+     * @remarks This class is thread safe!
+     */
+    class TransmitRateLimiter {
+        public: // +++ Constructor / Destructor +++
+            explicit                TransmitRateLimiter(const uint32_t nominalBitrate = 500000, const uint32_t dataBitrate = 0);
+            explicit                TransmitRateLimiter(const TransmitRateLimiter&) = delete; //!< Prevents copy-construction
+            virtual ~               TransmitRateLimiter() {}
+
+        public: // +++ Getter / Setter +++
+            TransmitRateLimiter&    setBandwidthShare(const double share, const microseconds& burst = microseconds(2000)); //!< Caps transmissions to share (0.0 - 1.0) of the bus
+            TransmitRateLimiter&    setClockCallback(const gettickcb_t& val) { m_getMicrosCallback = val; return *this; } //!< Overrides the microsecond clock
+
+            BusLoadEstimator&       getEstimator() { return m_estimator; }
+            double                  getUtilisation() { return m_estimator.getUtilisation(getMicros()); } //!< Gets the live utilisation caused by transmitted frames
+            uint64_t                getThrottledFrames(); //!< Gets the amount of requests denied since construction
+
+        public: // +++ Rate limiting +++
+            bool                    tryAcquire(const CanId& canId, const uint8_t dataLength, const bool canFd = false, const bool bitRateSwitch = false); //!< Reserves a frame's bus time
+            void                    commit(const CanId& canId, const uint8_t dataLength, const bool sent, const bool canFd = false, const bool bitRateSwitch = false); //!< Records a sent frame, or refunds an unsent one
+
+        private: // +++ Internal Functions +++
+            uint64_t                getMicros() const;
+
+        private:
+            BusLoadEstimator        m_estimator;
+
+            bool                    m_limited;
+
+            double                  m_share;
+            double                  m_tokensNanos; //!< Bus time currently available; negative while in debt
+
+            gettickcb_t             m_getMicrosCallback;
+
+            mutex                   m_lock;
+
+            uint64_t                m_burstNanos;
+            uint64_t                m_lastRefillMicros;
+            uint64_t                m_throttledFrames;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_BUSLOADESTIMATOR_HPP
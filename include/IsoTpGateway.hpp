@@ -0,0 +1,208 @@
+/**
+ * @file IsoTpGateway.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the cut-through ISOTP gateway, which routes messages between two CAN buses.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_ISOTPGATEWAY_HPP
+#define ISOTPP_INCLUDE_ISOTPGATEWAY_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <array>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "AcceptanceFilter.hpp"
+#include "ReassemblyBudget.hpp"
+#include "types/CanId.hpp"
+#include "types/FrameFlags.hpp"
+#include "types/ReturnValue.hpp"
+#include "types/Typedefs.hpp"
+
+namespace isotpp {
+
+    using std::array;
+    using std::chrono::milliseconds;
+    using std::deque;
+    using std::map;
+    using std::mutex;
+    using std::shared_ptr;
+    using std::vector;
+
+    using types::CanId;
+    using types::FlowControlFlag;
+    using types::ReturnValue;
+
+    /**
+     * @brief The two buses connected by the gateway.
+     */
+    enum class BusSide: uint8_t {
+        BUS_A = 0,
+        BUS_B = 1
+    };
+
+    /**
+     * @brief A unidirectional route through the gateway.
+     *
+     * Diagnostic request/response pairs need two routes, one per direction. As each peer sends its data and its FCs
+     * with the same ID, the ingressRxId of one is the egressRxId of the other.
+     */
+    struct GatewayRoute {
+        GatewayRoute(const BusSide ingress, const CanId& ingressRxId, const CanId& ingressTxId, const CanId& egressTxId, const CanId& egressRxId):
+        ingress(ingress), ingressRxId(ingressRxId), ingressTxId(ingressTxId), egressTxId(egressTxId), egressRxId(egressRxId) {}
+
+        BusSide             ingress; //!< The bus messages arrive on; they leave on the other one
+        CanId               ingressRxId; //!< The ID the sender's SF/FF/CFs arrive with
+        CanId               ingressTxId; //!< The ID the gateway sends FCs to the sender with
+        CanId               egressTxId; //!< The ID the gateway forwards SF/FF/CFs with
+        CanId               egressRxId; //!< The ID the receiver's FCs arrive with
+    };
+
+    /**
+     * @brief Forwards ISOTP messages between two buses without reassembling them.
+     *
+     * The route is decided from the single or first frame. First frames are forwarded immediately; consecutive frames
+     * are forwarded as they arrive, so a message leaves the gateway roughly one block after it started arriving
+     * instead of one full message-time later.
+     *
+     * Both sides run their own flow control. Towards the sender, the gateway grants blocks of the configured block size
+     * as long as the forwarding window has room for a full block and answers with FC WAIT otherwise. Towards the
+     * receiver, the receiver's BlockSize and STmin are obeyed. The receiver's first FC is relayed to the sender,
+     * so a receiver rejecting a message (FC OVERFLOW) rejects it at its source.
+     *
+     * A SF or FF from a sender which is still sending its message aborts that message, as it would on a direct link.
+     * Once the sender has sent its last CF though, the message is complete and only waits to be forwarded; a SF or FF
+     * arriving then is held back until the last CF has left the gateway. A held FF is answered with FC WAIT.
+     *
+     * Frames whose IDs are not part of any route are rejected by a per-bus @see AcceptanceFilter before any locking or decoding.
+     *
+     * With a @see ReassemblyBudget set, the length declared by each FF is admitted against it before the FF is forwarded,
+     * and stays reserved until the transfer ends. A FF which does not fit is held back and the sender is answered with
+     * FC WAIT; admission is retried every half timeout, each retry answered with another WAIT. FFs rejected by the budget
+     * are answered with FC OVERFLOW and never reach the receiver.
+     *
+     * @remarks Only classic CAN is supported; frames longer than 8 bytes are rejected. Frames are forwarded unchanged apart from their CAN ID.
+     * @remarks This class is thread safe!
+     * @remarks The tick callback is expected to return milliseconds.
+     */
+    class IsoTpGateway {
+        public: // +++ Constants +++
+            static const uint8_t    DEFAULT_BLOCK_SIZE = 8; //!< The default block size granted to senders
+            static const size_t     DEFAULT_WINDOW_FRAMES = 16; //!< The default amount of CFs buffered per route
+
+        public: // +++ Constructor / Destructor +++
+            explicit                IsoTpGateway(const uint8_t blockSize = DEFAULT_BLOCK_SIZE, const size_t windowFrames = DEFAULT_WINDOW_FRAMES);
+            explicit                IsoTpGateway(const IsoTpGateway&) = delete; //!< Prevents copy-construction
+            virtual ~               IsoTpGateway() {}
+
+        public: // +++ Getter / Setter +++
+            IsoTpGateway&           setSendCallback(const BusSide side, const sendcancb_t& val) { m_sendCanCallbacks[static_cast<size_t>(side)] = val; return *this; }
+            IsoTpGateway&           setTickCallback(const gettickcb_t& val) { m_getSysTickCallback = val; return *this; }
+            IsoTpGateway&           setTimeout(const milliseconds& val) { m_timeout = val; return *this; } //!< Sets N_Bs/N_Cr for both sides
+            IsoTpGateway&           setSeparationTime(const uint8_t val) { m_separationTime = val; return *this; } //!< Sets the raw STmin requested from senders
+            IsoTpGateway&           setReassemblyBudget(const shared_ptr<ReassemblyBudget>& val) { m_reassemblyBudget = val; return *this; } //!< Admits FFs against the budget before forwarding them; keyed by ingress bus and ingressRxId
+
+            ReturnValue             addRoute(const GatewayRoute& route); //!< Adds a route. Fails if another route already receives data, or FCs, with the same ID on the same bus.
+            ReturnValue             removeRoute(const BusSide ingress, const CanId& ingressRxId); //!< Removes the route receiving data with ingressRxId on the ingress bus
+
+        public: // +++ CAN message transception +++
+            ReturnValue             handleIncomingCanFrame(const BusSide side, const CanId& canId, const buf_t& frame); //!< Handles a frame received on either bus
+
+            size_t                  poll(); //!< Forwards due frames and handles timeouts; returns the amount of frames forwarded
+
+        private: // +++ Internal Types +++
+            /**
+             * @brief The forwarding state of a single route.
+             */
+            struct RouteSession {
+                explicit            RouteSession(const GatewayRoute& route): route(route) { reset(); }
+
+                void                reset();
+
+                GatewayRoute        route;
+                buf_t               firstFrame; //!< The FF held back while admission is pending
+                deque<buf_t>        window; //!< CFs received from the sender, not yet forwarded
+                deque<buf_t>        heldFrames; //!< The sender's next SFs (and at most one FF, last), held until the current message is forwarded
+
+                bool                active;
+                bool                admissionPending; //!< Whether the FF waits for the reassembly budget
+                bool                senderGranted; //!< Whether the sender received its first CTS
+                bool                grantPending; //!< Whether the sender finished a block and waits for the next CTS
+                bool                waitingForReceiver; //!< Whether the gateway waits for the receiver's FC
+                uint8_t             expectedSequenceNumber;
+                uint8_t             framesLeftInSenderBlock;
+                uint8_t             receiverBlockSize;
+                uint8_t             framesLeftInReceiverBlock;
+                uint16_t            messageLength;
+                uint16_t            bytesReceived;
+                uint16_t            bytesForwarded;
+                uint32_t            receiverSeparationTimeMicros;
+                uint64_t            firstFrameTick;
+                uint64_t            lastSenderFrameTick;
+                uint64_t            nextForwardTick;
+                uint64_t            receiverDeadline;
+            };
+
+        private: // +++ Internal Functions +++
+            static uint64_t         getRouteKey(const BusSide side, const CanId& canId) { return (static_cast<uint64_t>(side) << 32) | static_cast<uint32_t>(canId); }
+            static uint16_t         getPayloadLength(const RouteSession& session, const uint16_t bytesSoFar);
+
+            bool                    send(const BusSide side, const CanId& canId, const buf_t& frame);
+            bool                    sendFlowControl(const RouteSession& session, const FlowControlFlag flag, const uint8_t blockSize = 0, const uint8_t separationTime = 0);
+            void                    endTransfer(RouteSession& session);
+            void                    finishTransfer(RouteSession& session, const uint64_t now);
+            BusSide                 getEgress(const RouteSession& session) const { return session.route.ingress == BusSide::BUS_A ? BusSide::BUS_B : BusSide::BUS_A; }
+            uint64_t                getTick() const { return m_getSysTickCallback ? m_getSysTickCallback() : 0; }
+
+            ReturnValue             admitFirstFrame(RouteSession& session, const buf_t& frame, const uint64_t now);
+            ReturnValue             forwardFirstFrame(RouteSession& session, const buf_t& frame, const uint64_t now);
+            ReturnValue             handleSenderFrame(RouteSession& session, const buf_t& frame, const uint64_t now);
+            ReturnValue             holdSenderFrame(RouteSession& session, const buf_t& frame, const uint64_t now);
+            ReturnValue             handleReceiverFlowControl(RouteSession& session, const buf_t& frame, const uint64_t now);
+            size_t                  pump(RouteSession& session, const uint64_t now);
+            void                    grantSender(RouteSession& session, const uint64_t now);
+
+        private:
+            array<AcceptanceFilter, 2> m_acceptanceFilters;
+
+            array<sendcancb_t, 2>   m_sendCanCallbacks;
+
+            gettickcb_t             m_getSysTickCallback;
+
+            map<uint64_t, size_t>   m_flowControlRoutes; //!< (egress bus, egressRxId) -> session
+            map<uint64_t, size_t>   m_senderRoutes; //!< (ingress bus, ingressRxId) -> session
+
+            milliseconds            m_timeout;
+
+            mutex                   m_lock;
+
+            shared_ptr<ReassemblyBudget> m_reassemblyBudget;
+
+            size_t                  m_windowFrames;
+
+            uint8_t                 m_blockSize;
+            uint8_t                 m_separationTime;
+
+            vector<RouteSession>    m_sessions;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_ISOTPGATEWAY_HPP
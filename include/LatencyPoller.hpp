@@ -0,0 +1,105 @@
+/**
+ * @file LatencyPoller.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the low-latency busy-polling service.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_LATENCYPOLLER_HPP
+#define ISOTPP_INCLUDE_LATENCYPOLLER_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "types/ReturnValue.hpp"
+
+namespace isotpp {
+
+    using std::atomic;
+    using std::chrono::microseconds;
+    using std::function;
+    using std::mutex;
+    using std::thread;
+
+    using types::ReturnValue;
+
+    using pollcb_t = function<bool()>; //!< Polls once; returns true if any work was done
+
+    /**
+     * @brief Configuration for the low-latency polling mode.
+     */
+    struct LatencyPollerConfig {
+        LatencyPollerConfig(): cpu(-1), realtime(false), realtimePriority(50), spinIterations(10000), maxBackoff(100) {}
+
+        int32_t             cpu; //!< The CPU to pin the poller to; < 0 disables pinning. Must be below CPU_SETSIZE.
+        bool                realtime; //!< Whether to run the poller with SCHED_FIFO. Requires CAP_SYS_NICE.
+        int32_t             realtimePriority; //!< The SCHED_FIFO priority (1 - 99)
+        uint32_t            spinIterations; //!< Consecutive idle polls before backing off
+        microseconds        maxBackoff; //!< Upper bound of the exponential backoff; 0 spins forever
+    };
+
+    /**
+     * @brief A polling service which trades CPU time for latency.
+     *
+     * Instead of sleeping a fixed interval between iterations, the poller spins on the poll callback.
+     * Only after @see LatencyPollerConfig::spinIterations idle polls does it start sleeping, beginning at 1us and doubling
+     * up to @see LatencyPollerConfig::maxBackoff; any work done resets it to spinning.
+     * The thread may be pinned to a single CPU and run with real-time scheduling to avoid being preempted.
+     *
+     * @remarks This class is thread safe!
+     */
+    class LatencyPoller {
+        public: // +++ Constructor / Destructor +++
+            explicit                LatencyPoller(const pollcb_t& pollCallback = pollcb_t());
+            explicit                LatencyPoller(const LatencyPoller&) = delete; //!< Prevents copy-construction
+            virtual ~               LatencyPoller() { stop(); }
+
+        public: // +++ Getter / Setter +++
+            LatencyPoller&          setPollCallback(const pollcb_t& val) { m_pollCallback = val; return *this; } //!< Must not be called while running
+
+            bool                    isRunning() const { return m_keepPollerAlive; }
+            uint64_t                getIterations() const { return m_iterations; } //!< Gets the amount of polls since start
+            uint64_t                getBackoffs() const { return m_backoffs; } //!< Gets the amount of times the poller went to sleep since start
+
+        public: // +++ Polling +++
+            ReturnValue             start(const LatencyPollerConfig& config); //!< Starts the poller thread
+            void                    stop(); //!< Stops the poller thread
+
+        private: // +++ Internal Functions +++
+            static int              applyThreadConfig(const LatencyPollerConfig& config); //!< Returns 0 or an errno value
+            static void             cpuRelax();
+
+            void                    run(const LatencyPollerConfig config);
+
+        private:
+            atomic<bool>            m_keepPollerAlive;
+
+            atomic<uint64_t>        m_backoffs;
+            atomic<uint64_t>        m_iterations;
+
+            mutex                   m_lock;
+
+            pollcb_t                m_pollCallback;
+
+            thread                  m_pollerThread;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_LATENCYPOLLER_HPP
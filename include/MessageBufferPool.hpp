@@ -0,0 +1,120 @@
+/**
+ * @file MessageBufferPool.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the pool of reassembly buffers handed out as refcounted message handles.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_MESSAGEBUFFERPOOL_HPP
+#define ISOTPP_INCLUDE_MESSAGEBUFFERPOOL_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "types/CanId.hpp"
+#include "types/Helpers.hpp"
+#include "types/Typedefs.hpp"
+
+namespace isotpp {
+
+    using std::function;
+    using std::mutex;
+    using std::shared_ptr;
+    using std::unique_ptr;
+    using std::vector;
+
+    using types::CanId;
+
+    using msghandle_t = shared_ptr<const buf_t>; //!< Refcounted, immutable handle to a completed message
+    using msgcb_t = function<void(const CanId&, const msghandle_t&)>;
+
+    /**
+     * @brief A fixed set of reassembly buffers which are lent to the engine and handed out to the application without copying.
+     *
+     * The engine borrows a writable buffer via @see acquire, reassembles a message into it and then hands it out via @see publish,
+     * or via @see deliver, which also passes it to every registered consumer.
+     * Publishing does not copy: the returned handle refers to the very same buffer, now read-only, and may be passed
+     * to any number of consumers. Once the last handle (and the engine's own reference) is dropped, the buffer is
+     * cleared and returned to the pool; its capacity is retained.
+     *
+     * The handles' control blocks are placed in slots preallocated alongside the buffers, so lending and returning
+     * a buffer allocates nothing. Only while weak_ptrs keep the control blocks of more than the pool's capacity alive
+     * are further control blocks allocated from the heap.
+     *
+     * @remarks Handles may safely outlive the pool.
+     * @remarks This class is thread safe! Consumers are invoked with the consumer lock held and must not register further consumers.
+     */
+    class MessageBufferPool {
+        public: // +++ Constants +++
+            static const size_t     DEFAULT_CAPACITY = 4; //!< The default amount of buffers in the pool
+
+        public: // +++ Constructor / Destructor +++
+            explicit                MessageBufferPool(const size_t capacity = DEFAULT_CAPACITY, const size_t reserveBytes = types::ISOTP_MAX_MESSAGE_LENGTH);
+            explicit                MessageBufferPool(const MessageBufferPool&) = delete; //!< Prevents copy-construction
+            virtual ~               MessageBufferPool() {}
+
+        public: // +++ Buffer lending +++
+            shared_ptr<buf_t>       acquire(); //!< Lends a cleared, writable buffer. Empty if all buffers are in use.
+            msghandle_t             publish(shared_ptr<buf_t>& buffer); //!< Turns a reassembled buffer into an immutable handle
+            size_t                  deliver(const CanId& canId, shared_ptr<buf_t>& buffer); //!< Publishes a reassembled buffer and passes the handle to every consumer
+
+        public: // +++ Consumers +++
+            MessageBufferPool&      addConsumer(const msgcb_t& val); //!< Registers a consumer; all consumers share the same handle to each delivered message
+
+        public: // +++ Getter / Setter +++
+            size_t                  getAvailable(); //!< Gets the amount of buffers currently in the pool
+            size_t                  getCapacity() const { return m_capacity; }
+
+        private: // +++ Internal Types +++
+            static const size_t     CONTROL_BLOCK_SIZE = 128; //!< The size of a control block slot; checked against the actual control block at compile time
+
+            /**
+             * @brief Storage for a single shared_ptr control block.
+             */
+            struct ControlBlockSlot {
+                alignas(std::max_align_t) uint8_t data[CONTROL_BLOCK_SIZE];
+            };
+
+            /**
+             * @brief The state shared between the pool and all outstanding buffers.
+             */
+            struct PoolState {
+                mutex               lock;
+                vector<unique_ptr<buf_t>> storage; //!< Owns all buffers
+                vector<buf_t*>      available;
+                vector<ControlBlockSlot> controlBlocks; //!< Owns the control block slots; never resized after construction
+                vector<void*>       availableControlBlocks;
+            };
+
+            template<typename T>
+            struct ControlBlockAllocator;
+
+        private:
+            mutex                   m_consumerLock;
+
+            shared_ptr<PoolState>   m_state;
+
+            size_t                  m_capacity;
+
+            vector<msgcb_t>         m_consumers;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_MESSAGEBUFFERPOOL_HPP
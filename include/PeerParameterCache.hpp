@@ -0,0 +1,94 @@
+/**
+ * @file PeerParameterCache.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the peer parameter cache, which remembers the flow-control parameters of each peer.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_PEERPARAMETERCACHE_HPP
+#define ISOTPP_INCLUDE_PEERPARAMETERCACHE_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <chrono>
+#include <map>
+#include <mutex>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "types/CanId.hpp"
+
+namespace isotpp {
+
+    using std::chrono::milliseconds;
+    using std::map;
+    using std::mutex;
+
+    using types::CanId;
+
+    /**
+     * @brief The flow-control parameters last granted by a peer and how quickly it answers.
+     */
+    struct PeerParameters {
+        uint8_t             blockSize; //!< The last BS granted; 0 = unlimited
+        uint8_t             separationTime; //!< The last raw STmin requested
+        uint32_t            separationTimeMicros;
+        uint32_t            lastResponseTime; //!< Ticks between the FF (or last CF of a block) and the peer's FC
+        uint32_t            averageResponseTime; //!< Exponentially weighted moving average of the response time, in ticks
+        uint32_t            samples; //!< The amount of FCs recorded
+        uint64_t            lastUpdated; //!< The tick the last FC was recorded at
+    };
+
+    /**
+     * @brief Remembers the flow-control parameters and FC response times of each peer.
+     *
+     * ECUs practically never change their BS and STmin between transfers, so knowing the last values lets the
+     * @see TransmitScheduler segment the first block while the FF is still waiting for its FC, and plan the block's
+     * pacing before the FC arrives. The actual FC always takes precedence; it is recorded again on arrival.
+     *
+     * Entries older than the max. age are ignored, as the peer may have been reflashed or reconfigured in the meantime.
+     * Once the cache is full, the least recently updated peer is evicted.
+     *
+     * @remarks This class is thread safe!
+     * @remarks All ticks use the unit of the tick callback, which is expected to return milliseconds.
+     */
+    class PeerParameterCache {
+        public: // +++ Constants +++
+            static const size_t     DEFAULT_MAX_PEERS = 64; //!< The default amount of peers remembered
+
+        public: // +++ Constructor / Destructor +++
+            explicit                PeerParameterCache(const size_t maxPeers = DEFAULT_MAX_PEERS, const milliseconds& maxAge = milliseconds(60000));
+            explicit                PeerParameterCache(const PeerParameterCache&) = delete; //!< Prevents copy-construction
+            virtual ~               PeerParameterCache() {}
+
+        public: // +++ Cache maintenance +++
+            void                    recordFlowControl(const CanId& peer, const uint8_t blockSize, const uint8_t separationTime, const uint32_t responseTime, const uint64_t now); //!< Records a FC received from the peer
+            bool                    lookup(const CanId& peer, const uint64_t now, PeerParameters& parameters); //!< Gets the peer's parameters; false if unknown or expired
+            void                    invalidate(const CanId& peer);
+            void                    clear();
+
+        public: // +++ Getter / Setter +++
+            size_t                  getSize();
+
+        private:
+            map<uint32_t, PeerParameters> m_peers; //!< Keyed by the raw CAN ID messages are sent to the peer with
+
+            milliseconds            m_maxAge;
+
+            mutex                   m_lock;
+
+            size_t                  m_maxPeers;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_PEERPARAMETERCACHE_HPP
@@ -0,0 +1,128 @@
+/**
+ * @file ReassemblyBudget.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the reassembly memory budget, which decides whether incoming first frames are admitted.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_REASSEMBLYBUDGET_HPP
+#define ISOTPP_INCLUDE_REASSEMBLYBUDGET_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <map>
+#include <mutex>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "types/CanId.hpp"
+#include "types/FrameFlags.hpp"
+#include "types/Helpers.hpp"
+
+namespace isotpp {
+
+    using std::map;
+    using std::mutex;
+
+    using types::CanId;
+    using types::FlowControlFlag;
+
+    /**
+     * @brief Counters describing the admission decisions taken by a @see ReassemblyBudget.
+     */
+    struct ReassemblyBudgetStatistics {
+        uint64_t            admitted; //!< First frames admitted, answered with FC CONTINUE
+        uint64_t            waited; //!< First frames deferred, answered with FC WAIT
+        uint64_t            rejected; //!< First frames rejected, answered with FC OVERFLOW
+        uint64_t            forgotten; //!< Waiting sessions evicted to keep the table of waiting sessions bounded
+        uint64_t            bytesInUse; //!< Bytes currently reserved by sessions
+        uint64_t            peakBytesInUse; //!< The highest amount of bytes reserved at once
+    };
+
+    /**
+     * @brief Bounds the memory reserved for reassembling incoming messages.
+     *
+     * Each first frame declares its message length up front. Before reserving any memory, the engine asks the budget
+     * to admit the message; the result is the flow-control flag to answer the first frame with:
+     *
+     *  - CONTINUE: the declared length was reserved for the session.
+     *  - WAIT: the message would fit once other sessions release memory. Ask again later; after the configured amount of
+     *    waits (N_WFTmax) the message is rejected.
+     *  - ABORT_TRANSMISSION (overflow): the message exceeds the per-session or global limit, or waited too often.
+     *
+     * A session holds at most one reservation; admitting a new message for a session releases its previous reservation,
+     * just as a new first frame aborts the message being received. Sessions are identified by their CAN ID, or by any
+     * 64-bit key where the ID alone is ambiguous, e.g. a gateway's bus and ID. The two are the same key for IDs (bus 0).
+     *
+     * Sessions which were answered with WAIT are remembered until they are admitted, rejected or released. A sender may
+     * give up without the engine noticing, so at most maxWaitingSessions are remembered; beyond that, the session which
+     * waited least recently is forgotten, and starts counting its waits anew should it ever ask again.
+     *
+     * @remarks This class is thread safe!
+     */
+    class ReassemblyBudget {
+        public: // +++ Constants +++
+            static const size_t     DEFAULT_GLOBAL_LIMIT = 64 * 1024; //!< The default amount of bytes all sessions may reserve together
+            static const size_t     DEFAULT_SESSION_LIMIT = types::ISOTP_MAX_MESSAGE_LENGTH; //!< The default amount of bytes a single session may reserve
+            static const uint8_t    DEFAULT_MAX_WAITS = 8; //!< The default amount of FC WAITs before a first frame is rejected
+            static const size_t     DEFAULT_MAX_WAITING_SESSIONS = 64; //!< The default amount of waiting sessions remembered
+
+        public: // +++ Constructor / Destructor +++
+            explicit                ReassemblyBudget(const size_t globalLimit = DEFAULT_GLOBAL_LIMIT, const size_t sessionLimit = DEFAULT_SESSION_LIMIT, const uint8_t maxWaits = DEFAULT_MAX_WAITS,
+                                                     const size_t maxWaitingSessions = DEFAULT_MAX_WAITING_SESSIONS);
+            explicit                ReassemblyBudget(const ReassemblyBudget&) = delete; //!< Prevents copy-construction
+            virtual ~               ReassemblyBudget() {}
+
+        public: // +++ Admission control +++
+            FlowControlFlag         admit(const uint64_t sessionKey, const uint32_t declaredLength); //!< Decides how to answer a first frame
+            FlowControlFlag         admit(const CanId& sessionId, const uint32_t declaredLength) { return admit(static_cast<uint64_t>(static_cast<uint32_t>(sessionId)), declaredLength); }
+            void                    release(const uint64_t sessionKey); //!< Releases the session's reservation, or gives up waiting
+            void                    release(const CanId& sessionId) { release(static_cast<uint64_t>(static_cast<uint32_t>(sessionId))); }
+
+        public: // +++ Getter / Setter +++
+            ReassemblyBudgetStatistics getStatistics();
+
+            size_t                  getGlobalLimit() const { return m_globalLimit; }
+            size_t                  getSessionLimit() const { return m_sessionLimit; }
+
+        private: // +++ Internal Types +++
+            /**
+             * @brief A session which was answered with WAIT.
+             */
+            struct WaitingSession {
+                uint8_t             waits; //!< The amount of FC WAITs sent
+                uint64_t            lastWait; //!< The value of m_decisions at the last WAIT
+            };
+
+        private: // +++ Internal Functions +++
+            void                    releaseLocked(const uint64_t key);
+
+        private:
+            map<uint64_t, uint32_t> m_reservations; //!< session -> reserved bytes
+            map<uint64_t, WaitingSession> m_waitingSessions;
+
+            mutex                   m_lock;
+
+            ReassemblyBudgetStatistics m_statistics;
+
+            size_t                  m_globalLimit;
+            size_t                  m_maxWaitingSessions;
+            size_t                  m_sessionLimit;
+
+            uint64_t                m_decisions; //!< Counts admission decisions; orders the waiting sessions by age
+
+            uint8_t                 m_maxWaits;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_REASSEMBLYBUDGET_HPP
@@ -0,0 +1,147 @@
+/**
+ * @file SharedMemoryBus.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the shared-memory transport, which lets many processes share one CAN interface.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_SHAREDMEMORYBUS_HPP
+#define ISOTPP_INCLUDE_SHAREDMEMORYBUS_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "AcceptanceFilter.hpp"
+#include "types/CanId.hpp"
+#include "types/ReturnValue.hpp"
+#include "types/Typedefs.hpp"
+
+namespace isotpp {
+
+    using std::atomic;
+    using std::function;
+    using std::mutex;
+    using std::shared_ptr;
+    using std::string;
+
+    using types::CanId;
+    using types::ReturnValue;
+
+    using rxframecb_t = function<void(const CanId&, const uint8_t* data, const uint8_t length)>;
+
+    class SharedMemoryMapping; //!< The mapped region; defined in SharedMemoryBus.cpp
+
+    /**
+     * @brief The process owning the CAN interface.
+     *
+     * The owner is the only process doing socket I/O. Every frame it receives is published with @see publish into a
+     * broadcast ring in shared memory, which all clients read concurrently without copying it through the kernel again.
+     * Frames clients want to send are collected in a shared transmit queue, which the owner drains with
+     * @see drainTransmitQueue and writes to the socket. Frames the socket rejects stay queued, so clients see a full
+     * queue instead of losing frames silently.
+     *
+     * @remarks @see createInProcess sets up the same ring in anonymous memory, so owner and clients can be tested in a single process.
+     * @remarks This class is thread safe!
+     */
+    class SharedMemoryBusOwner {
+        public: // +++ Constants +++
+            static const size_t     DEFAULT_RX_CAPACITY = 1024; //!< The default amount of frames in the receive ring
+            static const size_t     DEFAULT_TX_CAPACITY = 256; //!< The default amount of frames in the transmit queue
+
+        public: // +++ Constructor / Destructor +++
+            explicit                SharedMemoryBusOwner(const size_t rxCapacity = DEFAULT_RX_CAPACITY, const size_t txCapacity = DEFAULT_TX_CAPACITY);
+            explicit                SharedMemoryBusOwner(const SharedMemoryBusOwner&) = delete; //!< Prevents copy-construction
+            virtual ~               SharedMemoryBusOwner();
+
+        public: // +++ Setup +++
+            ReturnValue             create(const string& name, const bool replaceExisting = false); //!< Creates a named POSIX shared-memory region, e.g. "/isotpp-can0"
+            ReturnValue             createInProcess(); //!< Creates an anonymous region for clients within this process
+
+        public: // +++ Frame transport +++
+            ReturnValue             publish(const CanId& canId, const uint8_t* data, const uint8_t length); //!< Publishes a frame received from the bus to all clients
+            size_t                  drainTransmitQueue(const sendcancb_t& sendCallback, const size_t maxFrames = SIZE_MAX); //!< Hands frames queued by clients to the socket
+
+        public: // +++ Getter / Setter +++
+            uint64_t                getSendFailures() const { return m_sendFailures; } //!< Gets the amount of times the send callback rejected a frame
+
+        private:
+            friend class            SharedMemoryBusClient;
+
+            shared_ptr<SharedMemoryMapping> m_mapping;
+
+            mutex                   m_lock;
+
+            atomic<uint64_t>        m_sendFailures;
+
+            size_t                  m_rxCapacity;
+            size_t                  m_txCapacity;
+
+            string                  m_name;
+
+            uint64_t                m_device; //!< Identifies the named region, so a replacement is not unlinked on destruction
+            uint64_t                m_inode;
+    };
+
+    /**
+     * @brief A process using a CAN interface owned by a @see SharedMemoryBusOwner.
+     *
+     * Each client keeps its own read position in the receive ring. Frames are read straight from shared memory;
+     * with an acceptance filter set, unrelated frames are skipped after reading only their ID.
+     * A client which falls more than the ring's capacity behind loses the oldest frames, which is reported via @see getLostFrames.
+     *
+     * @see send matches @see sendcancb_t, so a client can be handed directly to IsoTpp as its send hook; @see receive
+     * feeds frames into the receive hook.
+     *
+     * @remarks This class is thread safe!
+     */
+    class SharedMemoryBusClient {
+        public: // +++ Constructor / Destructor +++
+            explicit                SharedMemoryBusClient();
+            explicit                SharedMemoryBusClient(const SharedMemoryBusClient&) = delete; //!< Prevents copy-construction
+            virtual ~               SharedMemoryBusClient() {}
+
+        public: // +++ Setup +++
+            ReturnValue             attach(const string& name); //!< Attaches to a named region created by another process
+            ReturnValue             attach(const SharedMemoryBusOwner& owner); //!< Attaches to an owner within this process
+
+            void                    setAcceptanceFilter(const shared_ptr<AcceptanceFilter>& val) { m_acceptanceFilter = val; }
+
+        public: // +++ Frame transport +++
+            size_t                  receive(const rxframecb_t& callback, const size_t maxFrames = SIZE_MAX); //!< Reads new frames; returns the amount passed to the callback
+            bool                    send(const CanId& canId, const buf_t& frame); //!< Queues a frame for the owner to send
+
+            uint64_t                getLostFrames() const { return m_lostFrames; }
+
+        private:
+            ReturnValue             attachMapping(const shared_ptr<SharedMemoryMapping>& mapping);
+
+        private:
+            shared_ptr<AcceptanceFilter> m_acceptanceFilter;
+
+            shared_ptr<SharedMemoryMapping> m_mapping;
+
+            mutex                   m_lock;
+
+            uint64_t                m_lostFrames;
+            uint64_t                m_readIndex;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_SHAREDMEMORYBUS_HPP
@@ -0,0 +1,533 @@
+/**
+ * @file StaticIsoTp.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the statically sized ISOTP engine used by the embedded build profile.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_STATICISOTP_HPP
+#define ISOTPP_INCLUDE_STATICISOTP_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// libc
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "Tracepoints.hpp"
+#include "types/FrameFlags.hpp"
+#include "types/FrameType.hpp"
+#include "types/Helpers.hpp"
+#include "types/ReturnValue.hpp"
+
+namespace isotpp {
+
+    using types::FlowControlFlag;
+    using types::FrameType;
+    using types::ReturnValue;
+
+    using staticsendcb_t = bool (*)(void* context, const uint32_t canId, const uint8_t* frame, const uint8_t length); //!< Sends a single CAN frame
+    using staticrxcb_t = void (*)(void* context, const uint32_t rxId, const uint8_t* data, const uint16_t length); //!< Receives a complete message; data is only valid during the call
+    using statictxdonecb_t = void (*)(void* context, const uint32_t txId, const ReturnValue result); //!< Reports the outcome of a message passed to send()
+    using statictickcb_t = uint64_t (*)(); //!< Gets the current tick in milliseconds
+
+    /**
+     * @brief An ISOTP engine whose entire storage is sized at compile time.
+     *
+     * Each of the MaxSessions sessions pairs the CAN ID messages are sent with (txId) and the ID they are received
+     * with (rxId), and owns a reassembly buffer of MaxMessageSize bytes. Nothing is allocated and no exception is thrown;
+     * the instance can live in static storage, and all errors are reported through @see ReturnValue.
+     * Callbacks are plain function pointers with a user context, as std::function may allocate.
+     *
+     * Outgoing messages are not copied: the data passed to @see send must stay valid until the completion callback
+     * reports the message's outcome.
+     *
+     * @tparam MaxSessions The max. amount of concurrently open sessions.
+     * @tparam MaxMessageSize The max. length of a received message. Longer first frames are answered with FC OVERFLOW.
+     *
+     * @remarks This class is @b not thread safe; call it from a single context, or guard it with the platform's own lock.
+     * @remarks The tick callback is expected to return milliseconds.
+     */
+    template<size_t MaxSessions, size_t MaxMessageSize>
+    class StaticIsoTp {
+        static_assert(MaxSessions > 0, "StaticIsoTp needs at least one session");
+        static_assert(MaxMessageSize > types::SINGLE_FRAME_MAX_DATA && MaxMessageSize <= types::ISOTP_MAX_MESSAGE_LENGTH,
+                      "MaxMessageSize must be between 8 and 4095 bytes");
+
+        public: // +++ Constructor / Destructor +++
+            explicit                StaticIsoTp(): m_getSysTickCallback(nullptr), m_sendCanCallback(nullptr), m_receiveCallback(nullptr), m_completionCallback(nullptr),
+                                    m_context(nullptr), m_timeout(1000), m_blockSize(8), m_separationTime(0) {
+                for (size_t i = 0; i < MaxSessions; i++) { m_sessions[i].used = false; }
+            }
+            explicit                StaticIsoTp(const StaticIsoTp&) = delete; //!< Prevents copy-construction
+                                    ~ StaticIsoTp() {} //!< Not virtual; a deleting destructor would reference operator delete
+
+        public: // +++ Getter / Setter +++
+            StaticIsoTp&            setContext(void* val) { m_context = val; return *this; } //!< Passed to every callback
+            StaticIsoTp&            setSendCallback(const staticsendcb_t val) { m_sendCanCallback = val; return *this; }
+            StaticIsoTp&            setReceiveCallback(const staticrxcb_t val) { m_receiveCallback = val; return *this; }
+            StaticIsoTp&            setCompletionCallback(const statictxdonecb_t val) { m_completionCallback = val; return *this; }
+            StaticIsoTp&            setTickCallback(const statictickcb_t val) { m_getSysTickCallback = val; return *this; }
+            StaticIsoTp&            setTimeout(const uint32_t val) { m_timeout = val; return *this; } //!< N_Bs and N_Cr, in milliseconds
+            StaticIsoTp&            setBlockSize(const uint8_t val) { m_blockSize = val; return *this; } //!< The BS advertised to senders
+            StaticIsoTp&            setSeparationTime(const uint8_t val) { m_separationTime = val; return *this; } //!< The raw STmin advertised to senders
+
+            static constexpr size_t getMaxSessions() { return MaxSessions; }
+            static constexpr size_t getMaxMessageSize() { return MaxMessageSize; }
+
+        public: // +++ Sessions +++
+            /**
+             * @brief Opens a session.
+             *
+             * @param txId The CAN ID messages and FCs are sent to the peer with.
+             * @param rxId The CAN ID the peer sends with.
+             *
+             * @return ReturnValue::SUCCESS if the session was opened.
+             * @return ReturnValue::IN_PROGRESS if a session with either ID is already open.
+             * @return ReturnValue::BUFFER_FULL if all MaxSessions sessions are in use.
+             */
+            ReturnValue             openSession(const uint32_t txId, const uint32_t rxId) {
+                Session* freeSession = nullptr;
+
+                for (size_t i = 0; i < MaxSessions; i++) {
+                    Session& session = m_sessions[i];
+
+                    if (!session.used) {
+                        if (freeSession == nullptr) { freeSession = &session; }
+                    } else if (session.txId == txId || session.rxId == rxId) {
+                        return ReturnValue::IN_PROGRESS;
+                    }
+                }
+
+                if (freeSession == nullptr) { return ReturnValue::BUFFER_FULL; }
+
+                freeSession->used = true;
+                freeSession->txId = txId;
+                freeSession->rxId = rxId;
+                resetReceive(*freeSession);
+                resetTransmit(*freeSession);
+
+                return ReturnValue::SUCCESS;
+            }
+
+            /**
+             * @brief Closes the session receiving with rxId. A message still being sent is reported as TIMEOUT_OCCURRED.
+             *
+             * @return ReturnValue::SUCCESS if the session was closed.
+             * @return ReturnValue::NO_ROUTE if no session receives with rxId.
+             */
+            ReturnValue             closeSession(const uint32_t rxId) {
+                Session* session = findByRxId(rxId);
+                if (session == nullptr) { return ReturnValue::NO_ROUTE; }
+
+                if (session->txState != TransmitState::IDLE) { finishTransmit(*session, ReturnValue::TIMEOUT_OCCURRED, getTick()); }
+                session->used = false;
+
+                return ReturnValue::SUCCESS;
+            }
+
+        public: // +++ CAN message transception +++
+            /**
+             * @brief Starts sending a message. SFs are sent right away, longer messages are continued by @see poll.
+             *
+             * @param txId The CAN ID of an open session.
+             * @param data The payload. Must stay valid until the completion callback is invoked.
+             * @param length The payload length; 1 - 4095 bytes.
+             *
+             * @return ReturnValue::SUCCESS if the SF or FF was sent.
+             * @return ReturnValue::NO_ROUTE if no session sends with txId.
+             * @return ReturnValue::IN_PROGRESS if the session is still sending another message.
+             * @return ReturnValue::INVALID_LENGTH if the message is empty.
+             * @return ReturnValue::OVERFLOW if the message is too large for ISOTP.
+             * @return ReturnValue::ERROR if the send callback failed.
+             */
+            ReturnValue             send(const uint32_t txId, const uint8_t* data, const uint16_t length) {
+                Session* session = findByTxId(txId);
+
+                if (session == nullptr) { return ReturnValue::NO_ROUTE; }
+                if (session->txState != TransmitState::IDLE) { return ReturnValue::IN_PROGRESS; }
+                if (data == nullptr || length == 0) { return ReturnValue::INVALID_LENGTH; }
+                if (length > types::ISOTP_MAX_MESSAGE_LENGTH) { return ReturnValue::OVERFLOW; }
+
+                const uint64_t now = getTick();
+                uint8_t frame[CAN_MAX_DLEN];
+
+                session->txData = data;
+                session->txLength = length;
+                session->txStarted = now;
+
+                if (length <= types::SINGLE_FRAME_MAX_DATA) {
+                    frame[0] = (static_cast<uint8_t>(FrameType::SINGLE_FRAME) << 4) | length;
+                    memcpy(frame + 1, data, length);
+
+                    session->txState = TransmitState::SENDING; // so finishTransmit reports the message
+                    const ReturnValue result = sendFrame(txId, frame, length + 1) ? ReturnValue::SUCCESS : ReturnValue::ERROR;
+                    if (result == ReturnValue::SUCCESS) { ISOTPP_TRACE4(frame_send, txId, static_cast<uint8_t>(FrameType::SINGLE_FRAME), 0, 0); }
+                    finishTransmit(*session, result, now);
+
+                    return result;
+                }
+
+                frame[0] = (static_cast<uint8_t>(FrameType::FIRST_FRAME) << 4) | ((length >> 8) & 0x0f);
+                frame[1] = length & 0xff;
+                memcpy(frame + 2, data, types::FIRST_FRAME_DATA);
+
+                if (!sendFrame(txId, frame, CAN_MAX_DLEN)) {
+                    resetTransmit(*session);
+                    return ReturnValue::ERROR;
+                }
+
+                ISOTPP_TRACE4(frame_send, txId, static_cast<uint8_t>(FrameType::FIRST_FRAME), 0, 0);
+
+                session->txState = TransmitState::WAIT_FLOW_CONTROL;
+                session->txOffset = types::FIRST_FRAME_DATA;
+                session->txSequenceNumber = 1;
+                session->txDeadline = now + m_timeout;
+
+                return ReturnValue::SUCCESS;
+            }
+
+            /**
+             * @brief Handles a CAN frame received from the bus.
+             *
+             * @param canId The frame's CAN ID.
+             * @param frame The frame's data.
+             * @param length The frame's length.
+             *
+             * @return ReturnValue::SUCCESS if the frame was processed.
+             * @return ReturnValue::NO_ROUTE if no session receives with canId.
+             * @return ReturnValue::INVALID_LENGTH if the frame is too short for its type.
+             * @return ReturnValue::UNEXPECTED_FRAME if the frame is out of sequence or unexpected in the session's state.
+             * @return ReturnValue::OVERFLOW if a FF announced more than MaxMessageSize bytes, or the peer aborted our transmission.
+             * @return ReturnValue::ERROR if a FC could not be sent.
+             */
+            ReturnValue             handleIncomingCanFrame(const uint32_t canId, const uint8_t* frame, const uint8_t length) {
+                Session* session = findByRxId(canId);
+
+                if (session == nullptr) { return ReturnValue::NO_ROUTE; }
+                if (frame == nullptr || length == 0) { return ReturnValue::INVALID_LENGTH; }
+
+                const uint64_t now = getTick();
+
+                ISOTPP_TRACE3(frame_dispatch, canId, static_cast<uint8_t>(frame[0] >> 4), static_cast<uint8_t>(frame[0] & 0x0f));
+
+                switch (types::getFrameType(frame[0])) {
+                    case FrameType::SINGLE_FRAME:
+                        return handleSingleFrame(*session, frame, length);
+                    case FrameType::FIRST_FRAME:
+                        return handleFirstFrame(*session, frame, length, now);
+                    case FrameType::CONSECUTIVE_FRAME:
+                        return handleConsecutiveFrame(*session, frame, length, now);
+                    case FrameType::FLOW_CONTROL_FRAME:
+                        return handleFlowControlFrame(*session, frame, length, now);
+                    default:
+                        return ReturnValue::UNEXPECTED_FRAME;
+                }
+            }
+
+        public: // +++ Polling +++
+            /**
+             * @brief Sends all CFs which are due and handles timeouts. Call at least once per millisecond while transfers are active.
+             */
+            void                    poll() {
+                const uint64_t now = getTick();
+
+                for (size_t i = 0; i < MaxSessions; i++) {
+                    Session& session = m_sessions[i];
+                    if (!session.used) { continue; }
+
+                    if (session.rxState == ReceiveState::RECEIVING && now >= session.rxDeadline) {
+                        ISOTPP_TRACE2(timeout, session.rxId, ISOTPP_TIMEOUT_N_CR);
+                        resetReceive(session);
+                    }
+
+                    if (session.txState == TransmitState::WAIT_FLOW_CONTROL && now >= session.txDeadline) {
+                        ISOTPP_TRACE2(timeout, session.txId, ISOTPP_TIMEOUT_N_BS);
+                        finishTransmit(session, ReturnValue::TIMEOUT_OCCURRED, now);
+                    }
+
+                    while (session.txState == TransmitState::SENDING && now >= session.txNextFrameTick) {
+                        sendConsecutiveFrame(session, now);
+                    }
+                }
+            }
+
+        private: // +++ Internal Types +++
+            enum class ReceiveState: uint8_t {
+                IDLE,
+                RECEIVING
+            };
+
+            enum class TransmitState: uint8_t {
+                IDLE,
+                WAIT_FLOW_CONTROL,      //!< A FF or the last CF of a block was sent; waiting for the peer's FC
+                SENDING
+            };
+
+            /**
+             * @brief A pair of CAN IDs and the state of both directions of the transfer.
+             */
+            struct Session {
+                bool                used;
+                uint32_t            txId;
+                uint32_t            rxId;
+
+                ReceiveState        rxState;
+                uint8_t             rxSequenceNumber;
+                uint8_t             rxFramesLeftInBlock;
+                uint16_t            rxLength;
+                uint16_t            rxOffset;
+                uint64_t            rxDeadline; //!< The tick at which waiting for the next CF times out (N_Cr)
+                uint8_t             rxBuffer[MaxMessageSize];
+
+                TransmitState       txState;
+                uint8_t             txSequenceNumber;
+                uint8_t             txBlockSize; //!< The block size last granted by the peer; 0 = unlimited
+                uint8_t             txFramesLeftInBlock;
+                uint16_t            txLength;
+                uint16_t            txOffset;
+                uint32_t            txSeparationTimeMicros;
+                uint64_t            txNextFrameTick;
+                uint64_t            txDeadline; //!< The tick at which waiting for FC times out (N_Bs)
+                uint64_t            txStarted;
+                const uint8_t*      txData;
+            };
+
+        private: // +++ Internal Functions +++
+            uint64_t                getTick() const { return m_getSysTickCallback != nullptr ? m_getSysTickCallback() : 0; }
+
+            bool                    sendFrame(const uint32_t canId, const uint8_t* frame, const uint8_t length) {
+                return m_sendCanCallback != nullptr && m_sendCanCallback(m_context, canId, frame, length);
+            }
+
+            bool                    sendFlowControlFrame(const Session& session, const FlowControlFlag flag) {
+                const uint8_t frame[] = {
+                    static_cast<uint8_t>((static_cast<uint8_t>(FrameType::FLOW_CONTROL_FRAME) << 4) | static_cast<uint8_t>(flag)),
+                    m_blockSize,
+                    m_separationTime
+                };
+
+                ISOTPP_TRACE4(fc_send, session.rxId, static_cast<uint8_t>(flag), m_blockSize, m_separationTime);
+                return sendFrame(session.txId, frame, sizeof(frame));
+            }
+
+            Session*                findByRxId(const uint32_t rxId) {
+                for (size_t i = 0; i < MaxSessions; i++) {
+                    if (m_sessions[i].used && m_sessions[i].rxId == rxId) { return &m_sessions[i]; }
+                }
+                return nullptr;
+            }
+
+            Session*                findByTxId(const uint32_t txId) {
+                for (size_t i = 0; i < MaxSessions; i++) {
+                    if (m_sessions[i].used && m_sessions[i].txId == txId) { return &m_sessions[i]; }
+                }
+                return nullptr;
+            }
+
+            void                    resetReceive(Session& session) {
+                session.rxState = ReceiveState::IDLE;
+                session.rxSequenceNumber = 0;
+                session.rxFramesLeftInBlock = 0;
+                session.rxLength = 0;
+                session.rxOffset = 0;
+                session.rxDeadline = 0;
+            }
+
+            void                    resetTransmit(Session& session) {
+                session.txState = TransmitState::IDLE;
+                session.txSequenceNumber = 0;
+                session.txBlockSize = 0;
+                session.txFramesLeftInBlock = 0;
+                session.txLength = 0;
+                session.txOffset = 0;
+                session.txSeparationTimeMicros = 0;
+                session.txNextFrameTick = 0;
+                session.txDeadline = 0;
+                session.txStarted = 0;
+                session.txData = nullptr;
+            }
+
+            void                    finishTransmit(Session& session, const ReturnValue result, const uint64_t now) {
+                ISOTPP_TRACE4(message_complete, session.txId, session.txLength, static_cast<int32_t>(result), now - session.txStarted);
+
+                resetTransmit(session);
+                if (m_completionCallback != nullptr) { m_completionCallback(m_context, session.txId, result); }
+            }
+
+            void                    deliver(Session& session, const uint8_t* data, const uint16_t length) {
+                if (m_receiveCallback != nullptr) { m_receiveCallback(m_context, session.rxId, data, length); }
+            }
+
+            ReturnValue             handleSingleFrame(Session& session, const uint8_t* frame, const uint8_t length) {
+                const uint8_t dataLength = frame[0] & 0x0f;
+
+                if (dataLength == 0 || dataLength > types::SINGLE_FRAME_MAX_DATA || length < dataLength + 1) { return ReturnValue::INVALID_LENGTH; }
+
+                resetReceive(session); // a new message aborts the current one
+                memcpy(session.rxBuffer, frame + 1, dataLength);
+                deliver(session, session.rxBuffer, dataLength);
+
+                return ReturnValue::SUCCESS;
+            }
+
+            ReturnValue             handleFirstFrame(Session& session, const uint8_t* frame, const uint8_t length, const uint64_t now) {
+                if (length < CAN_MAX_DLEN) { return ReturnValue::INVALID_LENGTH; }
+
+                const uint16_t messageLength = ((frame[0] & 0x0f) << 8) | frame[1];
+                if (messageLength <= types::SINGLE_FRAME_MAX_DATA) { return ReturnValue::INVALID_LENGTH; }
+
+                resetReceive(session);
+
+                if (messageLength > MaxMessageSize) {
+                    sendFlowControlFrame(session, FlowControlFlag::ABORT_TRANSMISSION);
+                    return ReturnValue::OVERFLOW;
+                }
+
+                memcpy(session.rxBuffer, frame + 2, types::FIRST_FRAME_DATA);
+                session.rxLength = messageLength;
+                session.rxOffset = types::FIRST_FRAME_DATA;
+                session.rxSequenceNumber = 1;
+                session.rxFramesLeftInBlock = m_blockSize;
+
+                if (!sendFlowControlFrame(session, FlowControlFlag::CONTINUE)) { return ReturnValue::ERROR; }
+
+                session.rxState = ReceiveState::RECEIVING;
+                session.rxDeadline = now + m_timeout;
+
+                return ReturnValue::SUCCESS;
+            }
+
+            ReturnValue             handleConsecutiveFrame(Session& session, const uint8_t* frame, const uint8_t length, const uint64_t now) {
+                if (session.rxState != ReceiveState::RECEIVING) { return ReturnValue::UNEXPECTED_FRAME; }
+
+                if ((frame[0] & 0x0f) != session.rxSequenceNumber) {
+                    resetReceive(session);
+                    return ReturnValue::UNEXPECTED_FRAME;
+                }
+
+                const uint16_t remaining = session.rxLength - session.rxOffset;
+                const uint8_t chunk = remaining < types::CONSECUTIVE_FRAME_MAX_DATA ? remaining : types::CONSECUTIVE_FRAME_MAX_DATA;
+
+                if (length < chunk + 1) {
+                    resetReceive(session);
+                    return ReturnValue::INVALID_LENGTH;
+                }
+
+                memcpy(session.rxBuffer + session.rxOffset, frame + 1, chunk);
+                session.rxOffset += chunk;
+                session.rxSequenceNumber = (session.rxSequenceNumber + 1) & 0x0f;
+                session.rxDeadline = now + m_timeout;
+
+                if (session.rxOffset >= session.rxLength) {
+                    const uint16_t messageLength = session.rxLength;
+
+                    resetReceive(session);
+                    deliver(session, session.rxBuffer, messageLength);
+                } else if (m_blockSize != 0 && --session.rxFramesLeftInBlock == 0) {
+                    session.rxFramesLeftInBlock = m_blockSize;
+
+                    if (!sendFlowControlFrame(session, FlowControlFlag::CONTINUE)) {
+                        resetReceive(session);
+                        return ReturnValue::ERROR;
+                    }
+                }
+
+                return ReturnValue::SUCCESS;
+            }
+
+            ReturnValue             handleFlowControlFrame(Session& session, const uint8_t* frame, const uint8_t length, const uint64_t now) {
+                if (session.txState != TransmitState::WAIT_FLOW_CONTROL) { return ReturnValue::UNEXPECTED_FRAME; }
+                if (length < 3) { return ReturnValue::INVALID_LENGTH; }
+
+                ISOTPP_TRACE5(fc_receive, session.txId, static_cast<uint8_t>(frame[0] & 0x0f), frame[1], frame[2], now + m_timeout - session.txDeadline);
+
+                switch (static_cast<FlowControlFlag>(frame[0] & 0x0f)) {
+                    case FlowControlFlag::CONTINUE:
+                        session.txState = TransmitState::SENDING;
+                        session.txBlockSize = frame[1];
+                        session.txFramesLeftInBlock = frame[1];
+                        session.txSeparationTimeMicros = types::separationTimeToMicros(frame[2]);
+                        session.txNextFrameTick = now; // STmin only applies between consecutive frames
+                        return ReturnValue::SUCCESS;
+                    case FlowControlFlag::WAIT:
+                        session.txDeadline = now + m_timeout;
+                        return ReturnValue::SUCCESS;
+                    case FlowControlFlag::ABORT_TRANSMISSION:
+                    default:
+                        finishTransmit(session, ReturnValue::OVERFLOW, now);
+                        return ReturnValue::OVERFLOW;
+                }
+            }
+
+            void                    sendConsecutiveFrame(Session& session, const uint64_t now) {
+                const uint16_t remaining = session.txLength - session.txOffset;
+                const uint8_t chunk = remaining < types::CONSECUTIVE_FRAME_MAX_DATA ? remaining : types::CONSECUTIVE_FRAME_MAX_DATA;
+                uint8_t frame[CAN_MAX_DLEN];
+
+                frame[0] = (static_cast<uint8_t>(FrameType::CONSECUTIVE_FRAME) << 4) | session.txSequenceNumber;
+                memcpy(frame + 1, session.txData + session.txOffset, chunk);
+
+                if (!sendFrame(session.txId, frame, chunk + 1)) {
+                    finishTransmit(session, ReturnValue::ERROR, now);
+                    return;
+                }
+
+                ISOTPP_TRACE4(frame_send, session.txId, static_cast<uint8_t>(FrameType::CONSECUTIVE_FRAME), session.txSequenceNumber, session.txOffset);
+
+                session.txOffset += chunk;
+                session.txSequenceNumber = (session.txSequenceNumber + 1) & 0x0f;
+
+                if (session.txOffset >= session.txLength) {
+                    finishTransmit(session, ReturnValue::SUCCESS, now);
+                } else if (session.txBlockSize != 0 && --session.txFramesLeftInBlock == 0) {
+                    session.txState = TransmitState::WAIT_FLOW_CONTROL;
+                    session.txDeadline = now + m_timeout;
+                } else {
+                    // round sub-tick separation times up, the peer must never receive frames faster than requested
+                    session.txNextFrameTick = now + (session.txSeparationTimeMicros + 999) / 1000;
+                }
+            }
+
+        private:
+            statictickcb_t          m_getSysTickCallback;
+            staticsendcb_t          m_sendCanCallback;
+            staticrxcb_t            m_receiveCallback;
+            statictxdonecb_t        m_completionCallback;
+
+            void*                   m_context;
+
+            Session                 m_sessions[MaxSessions];
+
+            uint32_t                m_timeout;
+
+            uint8_t                 m_blockSize;
+            uint8_t                 m_separationTime;
+    };
+
+#ifndef isotpp_EMBEDDED_MAX_SESSIONS
+#define isotpp_EMBEDDED_MAX_SESSIONS 4
+#endif // isotpp_EMBEDDED_MAX_SESSIONS
+
+#ifndef isotpp_EMBEDDED_MAX_MESSAGE_SIZE
+#define isotpp_EMBEDDED_MAX_MESSAGE_SIZE 4095
+#endif // isotpp_EMBEDDED_MAX_MESSAGE_SIZE
+
+    /**
+     * @brief The engine instantiated in the library, sized by the isotpp_EMBEDDED_MAX_SESSIONS and isotpp_EMBEDDED_MAX_MESSAGE_SIZE build options.
+     */
+    using EmbeddedIsoTp = StaticIsoTp<isotpp_EMBEDDED_MAX_SESSIONS, isotpp_EMBEDDED_MAX_MESSAGE_SIZE>;
+
+    extern template class StaticIsoTp<isotpp_EMBEDDED_MAX_SESSIONS, isotpp_EMBEDDED_MAX_MESSAGE_SIZE>;
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_STATICISOTP_HPP
@@ -0,0 +1,55 @@
+/**
+ * @file Tracepoints.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the static tracepoints (USDT probes) placed on the protocol's hot paths.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_TRACEPOINTS_HPP
+#define ISOTPP_INCLUDE_TRACEPOINTS_HPP
+
+/*
+ * When built with isotpp_USDT, every ISOTPP_TRACEn() compiles to a single nop plus an ELF note describing the probe,
+ * which bpftrace, perf or SystemTap patch into a trap only while attached. Otherwise the macros compile to nothing.
+ * Probe arguments must be values which are at hand anyway; they are evaluated whenever the probe site is reached.
+ *
+ * All probes belong to the provider "isotpp". arg0 identifies the session by the raw CAN ID its data frames travel on,
+ * so FCs are reported under the ID of the data they control. Ticks are in the unit of the tick callback (milliseconds);
+ * finer timing is left to the tracer's own clock.
+ *
+ *  probe                   arguments
+ *  frame_ingest            canId, pci, length                          A frame passed the acceptance filter
+ *  frame_dispatch          canId, frameType, lowNibble                 A frame was dispatched by type; lowNibble is the SN of CFs
+ *  cf_run                  canId, firstSequenceNumber, frames          A run of in-sequence CFs was dispatched in bulk
+ *  frame_send              canId, frameType, sequenceNumber, offset    A SF, FF or CF was sent
+ *  fc_send                 canId, flag, blockSize, separationTime      A FC was sent
+ *  fc_receive              canId, flag, blockSize, separationTime, responseTicks
+ *                                                                      A FC was received, responseTicks after the FF or block end
+ *  timeout                 canId, kind                                 A timer fired; kind is one of ISOTPP_TIMEOUT_*
+ *  message_complete        canId, length, result, durationTicks        A message was sent or forwarded; result is a ReturnValue
+ *
+ * Example scripts are found in tools/bpftrace.
+ */
+
+#define ISOTPP_TIMEOUT_N_BS 1 //!< The sender waited for FC in vain
+#define ISOTPP_TIMEOUT_N_CR 2 //!< The receiver waited for a CF in vain
+
+#ifdef isotpp_USDT
+#include <sys/sdt.h>
+
+#define ISOTPP_TRACE2(name, a1, a2)                 DTRACE_PROBE2(isotpp, name, a1, a2)
+#define ISOTPP_TRACE3(name, a1, a2, a3)             DTRACE_PROBE3(isotpp, name, a1, a2, a3)
+#define ISOTPP_TRACE4(name, a1, a2, a3, a4)         DTRACE_PROBE4(isotpp, name, a1, a2, a3, a4)
+#define ISOTPP_TRACE5(name, a1, a2, a3, a4, a5)     DTRACE_PROBE5(isotpp, name, a1, a2, a3, a4, a5)
+#else
+// sizeof() keeps values only used by probes from triggering unused warnings, without evaluating them
+#define ISOTPP_TRACE2(name, a1, a2)                 do { (void)sizeof(a1); (void)sizeof(a2); } while (0)
+#define ISOTPP_TRACE3(name, a1, a2, a3)             do { (void)sizeof(a1); (void)sizeof(a2); (void)sizeof(a3); } while (0)
+#define ISOTPP_TRACE4(name, a1, a2, a3, a4)         do { (void)sizeof(a1); (void)sizeof(a2); (void)sizeof(a3); (void)sizeof(a4); } while (0)
+#define ISOTPP_TRACE5(name, a1, a2, a3, a4, a5)     do { (void)sizeof(a1); (void)sizeof(a2); (void)sizeof(a3); (void)sizeof(a4); (void)sizeof(a5); } while (0)
+#endif // isotpp_USDT
+
+#endif // ISOTPP_INCLUDE_TRACEPOINTS_HPP
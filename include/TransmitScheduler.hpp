@@ -0,0 +1,177 @@
+/**
+ * @file TransmitScheduler.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declaration of the transmit scheduler, which interleaves outgoing messages to multiple peers.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_TRANSMITSCHEDULER_HPP
+#define ISOTPP_INCLUDE_TRANSMITSCHEDULER_HPP
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "BusLoadEstimator.hpp"
+#include "PeerParameterCache.hpp"
+#include "types/CanId.hpp"
+#include "types/FrameFlags.hpp"
+#include "types/ReturnValue.hpp"
+#include "types/Typedefs.hpp"
+
+namespace isotpp {
+
+    using std::chrono::milliseconds;
+    using std::deque;
+    using std::function;
+    using std::map;
+    using std::mutex;
+    using std::shared_ptr;
+
+    using types::CanId;
+    using types::FlowControlFlag;
+    using types::ReturnValue;
+
+    using txdonecb_t = function<void(const CanId&, const ReturnValue)>;
+
+    /**
+     * @brief Schedules the frames of multiple outgoing messages onto the bus.
+     *
+     * Each peer (identified by the CAN ID messages are sent to) has its own bounded queue of messages.
+     * Only the message at the head of a peer's queue is in transmission; messages to different peers are
+     * interleaved frame by frame, so a transfer stalled by FC WAIT or a large STmin no longer blocks other peers.
+     *
+     * Whenever more than one peer is ready to send, the frame with the lowest (priority, CAN ID) pair is sent first.
+     * All messages share the same default priority, so unless the user passes a priority the CAN arbitration
+     * order decides: the 11-bit base ID first, so a 29-bit ID competes with the top 11 bits of its identifier.
+     *
+     * If a rate limiter is set, every frame is charged against it; once the bandwidth share is used up,
+     * the remaining frames are held back until the next poll. Frames the bus rejects are refunded.
+     *
+     * If a peer parameter cache is set, every FC received is recorded in it. When a FF is sent to a peer whose
+     * parameters are known, the CFs of the first block are segmented right away, while the FF waits for its FC,
+     * and the block's pacing is planned from the cached BS and STmin. The FC's actual values always take precedence.
+     *
+     * @remarks This class is thread safe!
+     * @remarks The tick callback is expected to return milliseconds.
+     */
+    class TransmitScheduler {
+        public: // +++ Constants +++
+            static const uint8_t    DEFAULT_PRIORITY = 0x80; //!< The priority assigned to messages when none is passed
+            static const size_t     DEFAULT_QUEUE_DEPTH = 8; //!< The default max. amount of queued messages per peer
+            static const size_t     MAX_PREPARED_FRAMES = 32; //!< The max. amount of CFs segmented ahead of the first FC
+
+        public: // +++ Constructor / Destructor +++
+            explicit                TransmitScheduler(const size_t maxQueueDepth = DEFAULT_QUEUE_DEPTH);
+            explicit                TransmitScheduler(const TransmitScheduler&) = delete; //!< Prevents copy-construction
+            virtual ~               TransmitScheduler() {}
+
+        public: // +++ Getter / Setter +++
+            TransmitScheduler&      setSendCallback(const sendcancb_t& val) { m_sendCanCallback = val; return *this; }
+            TransmitScheduler&      setTickCallback(const gettickcb_t& val) { m_getSysTickCallback = val; return *this; }
+            TransmitScheduler&      setCompletionCallback(const txdonecb_t& val) { m_completionCallback = val; return *this; }
+            TransmitScheduler&      setFlowControlTimeout(const milliseconds& val) { m_flowControlTimeout = val; return *this; }
+            TransmitScheduler&      setRateLimiter(const shared_ptr<TransmitRateLimiter>& val) { m_rateLimiter = val; return *this; } //!< Charges every frame sent against the limiter
+            TransmitScheduler&      setPeerParameterCache(const shared_ptr<PeerParameterCache>& val) { m_peerParameterCache = val; return *this; } //!< Records FCs and pre-segments first blocks from them
+
+            size_t                  getPendingMessages(); //!< Gets the total amount of messages not yet fully sent
+
+        public: // +++ Scheduling +++
+            ReturnValue             enqueue(const buf_t& data, const CanId& txId, const uint8_t priority = DEFAULT_PRIORITY); //!< Queues a message for transmission
+            ReturnValue             handleFlowControlFrame(const CanId& txId, const FlowControlFlag flag, const uint8_t blockSize, const uint8_t separationTime); //!< Passes a received FC to the message sent to txId
+
+            size_t                  poll(); //!< Sends all frames which are due; returns the amount of frames sent
+
+        protected: // +++ Internal Types +++
+            /**
+             * @brief The states a peer's transmission can be in.
+             */
+            enum class TransmitState: uint8_t {
+                IDLE,                   //!< The head message has not been started yet
+                WAIT_FLOW_CONTROL,      //!< A FF or the last CF of a block was sent; waiting for the peer's FC
+                SENDING                 //!< Consecutive frames are being sent
+            };
+
+            /**
+             * @brief A single message queued for transmission.
+             */
+            struct PendingMessage {
+                buf_t               data;
+                uint8_t             priority;
+            };
+
+            /**
+             * @brief The transmission state towards a single peer.
+             */
+            struct PeerQueue {
+                explicit            PeerQueue(const CanId& id): txId(id), state(TransmitState::IDLE), offset(0), sequenceNumber(0),
+                                    blockSize(0), framesLeftInBlock(0), separationTimeMicros(0), nextFrameTick(0), flowControlDeadline(0), flowControlRequested(0), messageStarted(0) {}
+
+                CanId               txId;
+                deque<PendingMessage> messages;
+
+                TransmitState       state;
+                size_t              offset; //!< Offset of the next byte to send from the head message
+                uint8_t             sequenceNumber;
+                uint8_t             blockSize; //!< The block size last granted by the peer; 0 = unlimited
+                uint8_t             framesLeftInBlock;
+                uint32_t            separationTimeMicros;
+                uint64_t            nextFrameTick; //!< The earliest tick the next CF may be sent
+                uint64_t            flowControlDeadline; //!< The tick at which waiting for FC times out (N_Bs)
+                uint64_t            flowControlRequested; //!< The tick the FF or the last CF of a block was sent at
+                uint64_t            messageStarted; //!< The tick the head message's first frame was sent at
+
+                deque<buf_t>        preparedFrames; //!< The next CFs, segmented ahead of time
+            };
+
+            using completion_t = std::pair<CanId, ReturnValue>;
+
+        protected: // +++ Internal Functions +++
+            bool                    isReady(PeerQueue& peer, const uint64_t now, deque<completion_t>& completions);
+            size_t                  getNextFrameLength(const PeerQueue& peer) const;
+            buf_t                   buildConsecutiveFrame(const buf_t& data, const size_t offset, const uint8_t sequenceNumber) const;
+            void                    prepareFirstBlock(PeerQueue& peer, const uint64_t now);
+            bool                    sendNextFrame(PeerQueue& peer, const uint64_t now, deque<completion_t>& completions);
+            void                    finishMessage(PeerQueue& peer, const ReturnValue result, const uint64_t now, deque<completion_t>& completions);
+            void                    notify(deque<completion_t>& completions);
+            uint64_t                getTick() const { return m_getSysTickCallback ? m_getSysTickCallback() : 0; }
+
+        private:
+            gettickcb_t             m_getSysTickCallback;
+
+            map<uint32_t, PeerQueue> m_peers; //!< Keyed by the raw CAN ID messages are sent to
+
+            milliseconds            m_flowControlTimeout;
+
+            mutex                   m_lock;
+
+            sendcancb_t             m_sendCanCallback;
+
+            shared_ptr<PeerParameterCache> m_peerParameterCache;
+
+            shared_ptr<TransmitRateLimiter> m_rateLimiter;
+
+            size_t                  m_maxQueueDepth;
+
+            txdonecb_t              m_completionCallback;
+    };
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_TRANSMITSCHEDULER_HPP
@@ -30,9 +30,12 @@
 /////////////////////
 // LOCAL  INCLUDES //
 /////////////////////
+#include "MessageBufferPool.hpp"
+#include "TransmitScheduler.hpp"
 #include "types/CanId.hpp"
 #include "types/IsoTpFrame.hpp"
 #include "types/ReturnValue.hpp"
+#include "types/Typedefs.hpp"
 
 /**
  * @brief Top-level namespace for the library.
@@ -54,12 +57,6 @@ namespace isotpp {
     using types::FrameType;
     using types::ReturnValue;
 
-    // custom typedefs
-    using buf_t = vector<uint8_t>;
-    using logcb_t = function<void(const string&)>;
-    using sendcancb_t = function<bool(const CanId&, const buf_t&)>;
-    using gettickcb_t = function<uint64_t()>;
-
     /**
      * @brief Contains the most vital functions and information for establishing a link
      * via ISOTP.
@@ -87,6 +84,12 @@ namespace isotpp {
 
             ReturnValue     sendCanFrame(const buf_t&); //!< Sends one or more CAN frames
             ReturnValue     sendCanFrame(const buf_t&, const CanId); //!< Sends one or more CAN frames using the passed CAN ID
+            ReturnValue     sendCanFrame(const buf_t& data, const CanId id, const uint8_t priority) { return m_transmitScheduler.enqueue(data, id, priority); } //!< Sends one or more CAN frames using the passed CAN ID and scheduling priority
+
+            void            addMessageConsumer(const msgcb_t& val) { m_bufferPool.addConsumer(val); } //!< Registers a consumer; all consumers share the same handle to each completed message
+
+        public: // +++ Getter / Setter +++
+            IsoTpp&         setPeerParameterCache(const shared_ptr<PeerParameterCache>& val) { m_peerParameterCache = val; m_transmitScheduler.setPeerParameterCache(val); return *this; } //!< Lets the scheduler pre-segment first blocks from each peer's last FC
 
         protected: // +++ ISOTP Frame Sending +++
             ReturnValue     sendFlowControlFrame(const FlowControlFlag, const uint8_t blockSize, const uint8_t nextFrameInterval);
@@ -97,8 +100,10 @@ namespace isotpp {
         private:
             atomic<bool>    m_keepPollerAlive;
 
-            buf_t           m_receiveBuffer;
-            buf_t           m_sendBuffer;
+            MessageBufferPool m_bufferPool; //!< Lends reassembly buffers; completed messages are delivered from here without copying
+            shared_ptr<buf_t> m_receiveBuffer; //!< Borrowed from m_bufferPool for the message currently being reassembled
+            shared_ptr<PeerParameterCache> m_peerParameterCache; //!< Remembers each peer's FC parameters; handed to m_transmitScheduler by setPeerParameterCache
+            TransmitScheduler m_transmitScheduler; //!< Interleaves outgoing messages to multiple peers
 
             CanId           m_canId;
 
@@ -8,6 +8,8 @@
  * @copyright Copyright (c) 2022 Simon Cahill
  */
 
+#include <sys/types.h> // BYTE_ORDER
+
 #if BYTE_ORDER == BIG_ENDIAN
 #ifndef ISOTPP_INCLUDE_TYPES_BIGENDIANFRAMES_HPP
 #define ISOTPP_INCLUDE_TYPES_BIGENDIANFRAMES_HPP
@@ -27,22 +27,22 @@
 	// I don't like #defines if I can avoid them and this is pure C++,
 	// so I'll be using actual consts.
 	// Source: linux/can.h
-	const uint32_t CAN_EFF_FLAG 0x80000000U ///!< CAN extended frame format
-	const uint32_t CAN_RTR_FLAG 0x40000000U ///!< CAN remote transmission request
-	const uint32_t CAN_ERR_FLAG 0x20000000U ///!< CAN error frame flag
+	const uint32_t CAN_EFF_FLAG = 0x80000000U; ///!< CAN extended frame format
+	const uint32_t CAN_RTR_FLAG = 0x40000000U; ///!< CAN remote transmission request
+	const uint32_t CAN_ERR_FLAG = 0x20000000U; ///!< CAN error frame flag
 
-	const uint32_t CAN_SFF_MASK 0x000007FFU ///!< CAN standard frame format (SFF)
-	const uint32_t CAN_EFF_MASK 0x1FFFFFFFU ///!< CAN extended frame format (EFF)
-	const uint32_t CAN_ERR_MASK 0x1FFFFFFFU ///!< CAN omit EFF, RTR, ERR flags
+	const uint32_t CAN_SFF_MASK = 0x000007FFU; ///!< CAN standard frame format (SFF)
+	const uint32_t CAN_EFF_MASK = 0x1FFFFFFFU; ///!< CAN extended frame format (EFF)
+	const uint32_t CAN_ERR_MASK = 0x1FFFFFFFU; ///!< CAN omit EFF, RTR, ERR flags
 
-	const uint32_t CAN_SFF_ID_BITS	11
-	const uint32_t CAN_EFF_ID_BITS	29
+	const uint32_t CAN_SFF_ID_BITS	= 11;
+	const uint32_t CAN_EFF_ID_BITS	= 29;
 
 	
-	const uint32_t CAN_MAX_DLC 		8
-	const uint32_t CAN_MAX_DLEN 	8
-	const uint32_t CANFD_MAX_DLC 	15
-	const uint32_t CANFD_MAX_DLEN 	64
+	const uint32_t CAN_MAX_DLC 		= 8;
+	const uint32_t CAN_MAX_DLEN 	= 8;
+	const uint32_t CANFD_MAX_DLC 	= 15;
+	const uint32_t CANFD_MAX_DLEN 	= 64;
 
 #endif
 
@@ -57,8 +57,8 @@ namespace isotpp { namespace types {
 		explicit CanId(int32_t id) { m_canId = static_cast<uint32_t>(id); } // Smaller integer types can be implicitely casted
 
 		#pragma region "Implicit type casts"
-		operator uint32_t() { return m_canId; }
-		operator int32_t()  { return static_cast<int32_t>(m_canId); }
+		operator uint32_t() const { return m_canId; }
+		operator int32_t()  const { return static_cast<int32_t>(m_canId); }
 		// operator canid_t()  { return static_cast<canid_t>(m_canId); }
 
 		CanId operator =(const uint32_t id) { return CanId(id); }
@@ -66,9 +66,9 @@ namespace isotpp { namespace types {
 		#pragma endregion
 
 		#pragma region "Flag detection"
-		bool isExtendedFrame() 	{ return (m_canId & CAN_EFF_FLAG); }
-		bool isRemoteTrFrame() 	{ return (m_canId & CAN_RTR_FLAG); }
-		bool isErrorFrame()		{ return (m_canId & CAN_ERR_FLAG); }
+		bool isExtendedFrame() const { return (m_canId & CAN_EFF_FLAG); }
+		bool isRemoteTrFrame() const { return (m_canId & CAN_RTR_FLAG); }
+		bool isErrorFrame()    const { return (m_canId & CAN_ERR_FLAG); }
 		#pragma endregion
 
 		#pragma region "Flag setting"
@@ -78,8 +78,8 @@ namespace isotpp { namespace types {
 		#pragma endregion
 
 		#pragma region "Getters"
-		CanId getStandardFormat() { return CanId(m_canId & CAN_SFF_MASK); }
-		CanId getExtendedFormat() { return CanId(m_canId & CAN_EFF_MASK); }
+		CanId getStandardFormat() const { return CanId(m_canId & CAN_SFF_MASK); }
+		CanId getExtendedFormat() const { return CanId(m_canId & CAN_EFF_MASK); }
 		#pragma endregion
 
 		private:
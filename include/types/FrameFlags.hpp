@@ -32,7 +32,7 @@ namespace isotpp { namespace types {
         WAIT = 1,
 
         /**
-         * @brief The client has aborted the operation.
+         * @brief The client has aborted the operation (overflow), e.g. because the message is too large for its buffers.
          */
         ABORT_TRANSMISSION = 2
     };
@@ -12,19 +12,29 @@
 #define ISOTPP_INCLUDE_TYPES_ISOTPFRAME_HPP
 
 #include "types/CanId.hpp"
+#include "types/FrameFlags.hpp"
 #include "types/BigEndianFrames.hpp"
 #include "types/LittleEndianFrames.hpp"
-#include "types/FrameFlags.hpp"
 
 #include <stdint.h>
 
+#ifndef isotpp_EMBEDDED
 #include <algorithm>
 #include <vector>
+#endif // isotpp_EMBEDDED
 
 namespace isotpp { namespace types {
 
+#ifndef isotpp_EMBEDDED
     using std::vector;
+#endif // isotpp_EMBEDDED
+
+    const uint8_t   SINGLE_FRAME_MAX_DATA       = 7; //!< The max. amount of payload bytes carried by a single frame
+    const uint8_t   FIRST_FRAME_DATA            = 6; //!< The amount of payload bytes carried by a first frame
+    const uint8_t   CONSECUTIVE_FRAME_MAX_DATA  = 7; //!< The max. amount of payload bytes carried by a consecutive frame
+    const uint16_t  ISOTP_MAX_MESSAGE_LENGTH    = 4095; //!< The max. message length which can be expressed in a first frame
 
+#ifndef isotpp_EMBEDDED
     /**
      * @brief Transforms a byte pointer (@see uint8_t) to a vector containing the same data.
      * 
@@ -46,6 +56,90 @@ namespace isotpp { namespace types {
 
         return returnVal;
     }
+#endif // isotpp_EMBEDDED
+
+    /**
+     * @brief Converts the separation time (STmin) byte of a flow-control frame to microseconds.
+     * 
+     * @remarks Values 0x00 - 0x7F are milliseconds, 0xF1 - 0xF9 are 100 - 900 microseconds.
+     * All other values are reserved; ISO 15765-2 mandates these be treated as the longest STmin (127ms).
+     * 
+     * @param separationTime The raw STmin byte as received in a flow-control frame.
+     * 
+     * @return uint32_t The separation time in microseconds.
+     */
+    inline uint32_t separationTimeToMicros(const uint8_t separationTime) {
+        if (separationTime <= 0x7f) { return separationTime * 1000u; }
+        if (separationTime >= 0xf1 && separationTime <= 0xf9) { return (separationTime - 0xf0) * 100u; }
+
+        return 127000u;
+    }
+
+    /**
+     * @brief Converts a separation time in microseconds to the STmin byte sent in a flow-control frame.
+     * 
+     * @remarks The value is always rounded up, so the peer never sends faster than requested.
+     * Values larger than 127ms are clamped to 127ms.
+     * 
+     * @param micros The separation time in microseconds.
+     * 
+     * @return uint8_t The raw STmin byte.
+     */
+    inline uint8_t microsToSeparationTime(const uint32_t micros) {
+        if (micros == 0) { return 0; }
+        if (micros < 1000) {
+            const uint32_t hundreds = (micros + 99) / 100;
+            return hundreds >= 10 ? 0x01 : static_cast<uint8_t>(0xf0 + hundreds);
+        }
+
+        const uint32_t millis = (micros + 999) / 1000;
+        return millis > 0x7f ? 0x7f : static_cast<uint8_t>(millis);
+    }
+
+#ifndef isotpp_EMBEDDED
+    /**
+     * @brief Copies a raw frame struct (@see frames::SingleFrame_Struct etc.) into a vector which can be sent via CAN.
+     * 
+     * @param raw The frame struct.
+     * @param length The amount of bytes to copy. Truncated to the size of the struct.
+     * 
+     * @return vector<uint8_t> A new vector containing the frame
+     */
+    template<typename T>
+    inline vector<uint8_t> frameStructToVector(const T& raw, const size_t length = sizeof(T)) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(&raw);
+
+        return vector<uint8_t>(data, data + (length < sizeof(T) ? length : sizeof(T)));
+    }
+
+    /**
+     * @brief Builds a flow-control frame.
+     * 
+     * @param flag The flow-control flag.
+     * @param blockSize The amount of consecutive frames the peer may send before waiting for the next FC.
+     * @param separationTime The raw STmin byte.
+     * 
+     * @return vector<uint8_t> A new vector containing the three-byte frame
+     */
+    inline vector<uint8_t> makeFlowControlFrame(const FlowControlFlag flag, const uint8_t blockSize, const uint8_t separationTime) {
+        frames::FlowControlFrame_Struct raw = {};
+        raw.frameType = FrameType::FLOW_CONTROL_FRAME;
+        raw.flowControlFlag = flag;
+        raw.blockSize = blockSize;
+        raw.frameSeparationTime = separationTime;
+
+        return frameStructToVector(raw);
+    }
+#endif // isotpp_EMBEDDED
+
+    /**
+     * @brief Extracts the frame type from the first byte (PCI) of an ISOTP frame.
+     * 
+     * @param pci The first byte of the frame.
+     * 
+     * @return FrameType The frame type. Values above FLOW_CONTROL_FRAME are reserved and must be ignored.
+     */
+    inline FrameType getFrameType(const uint8_t pci) { return static_cast<FrameType>(pci >> 4); }
 
 } /* namespace types */ } /* namespace isotpp */
 
@@ -10,6 +10,8 @@
 
 #ifndef ISOTPP_INCLUDE_TYPES_LITTLEENDIANFRAMES_HPP
 #define ISOTPP_INCLUDE_TYPES_LITTLEENDIANFRAMES_HPP
+#include <sys/types.h> // BYTE_ORDER
+
 #if BYTE_ORDER == LITTLE_ENDIAN
 
 namespace isotpp { namespace types { namespace frames {
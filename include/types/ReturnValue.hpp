@@ -59,7 +59,12 @@ namespace isotpp { namespace types {
         /**
          * @brief The frame was an unexpected size.
          */
-        INVALID_LENGTH      = 7
+        INVALID_LENGTH      = 7,
+
+        /**
+         * @brief No route or session exists for the frame's CAN ID.
+         */
+        NO_ROUTE            = 8
     };
 
 } /* namespace types */ } /* namespace isotpp */
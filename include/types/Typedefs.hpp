@@ -0,0 +1,34 @@
+/**
+ * @file Typedefs.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the custom typedefs shared by IsoTpp and its components.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_INCLUDE_TYPES_TYPEDEFS_HPP
+#define ISOTPP_INCLUDE_TYPES_TYPEDEFS_HPP
+
+// stl
+#include <functional>
+#include <string>
+#include <vector>
+
+// libc
+#include <stdint.h>
+
+#include "types/CanId.hpp"
+
+namespace isotpp {
+
+    // custom typedefs
+    using buf_t = std::vector<uint8_t>;
+    using logcb_t = std::function<void(const std::string&)>;
+    using sendcancb_t = std::function<bool(const types::CanId&, const buf_t&)>;
+    using gettickcb_t = std::function<uint64_t()>;
+
+} /* namespace isotpp */
+
+#endif // ISOTPP_INCLUDE_TYPES_TYPEDEFS_HPP
@@ -0,0 +1,157 @@
+/**
+ * @file AcceptanceFilter.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the CAN ID acceptance filter.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include "AcceptanceFilter.hpp"
+
+namespace isotpp {
+
+    using std::memory_order_acquire;
+    using std::memory_order_relaxed;
+    using std::memory_order_release;
+    using std::unique_lock;
+
+    /**
+     * @brief Strips everything but the EFF flag and the ID bits valid for the frame format.
+     */
+    static uint32_t normaliseId(const uint32_t rawId) {
+        return (rawId & CAN_EFF_FLAG) ? (rawId & (CAN_EFF_FLAG | CAN_EFF_MASK)) : (rawId & CAN_SFF_MASK);
+    }
+
+    AcceptanceFilter::AcceptanceFilter(const size_t maxExtendedIds): m_extendedIdCount(0), m_sequence(0), m_extendedSlots(2), m_maxExtendedIds(maxExtendedIds) {
+        while (m_extendedSlots < maxExtendedIds * 2) { m_extendedSlots <<= 1; }
+
+        m_extendedIds.reset(new atomic<uint32_t>[m_extendedSlots]);
+        for (size_t i = 0; i < m_extendedSlots; i++) { m_extendedIds[i].store(0, memory_order_relaxed); }
+        for (auto& word : m_standardIds) { word.store(0, memory_order_relaxed); }
+    }
+
+    /**
+     * @brief Adds a reference to an ID.
+     *
+     * @return ReturnValue::SUCCESS if frames with the ID are now accepted.
+     * @return ReturnValue::BUFFER_FULL if the ID is extended and the max. amount of extended IDs is already in use.
+     */
+    ReturnValue AcceptanceFilter::addId(const CanId& canId) {
+        unique_lock<mutex> lock(m_lock);
+        const uint32_t id = normaliseId(static_cast<uint32_t>(canId));
+        auto reference = m_references.find(id);
+
+        if (reference != m_references.end()) {
+            reference->second++;
+            return ReturnValue::SUCCESS;
+        }
+
+        if (!(id & CAN_EFF_FLAG)) {
+            m_standardIds[id >> 6].fetch_or(1ull << (id & 63), memory_order_relaxed);
+        } else if (m_extendedIdCount.load(memory_order_relaxed) >= m_maxExtendedIds) {
+            return ReturnValue::BUFFER_FULL;
+        } else {
+            const uint32_t sequence = m_sequence.load(memory_order_relaxed);
+            m_sequence.store(sequence + 1, memory_order_relaxed);
+            std::atomic_thread_fence(memory_order_release);
+
+            insertExtended(id & CAN_EFF_MASK);
+
+            m_sequence.store(sequence + 2, memory_order_release);
+            m_extendedIdCount.fetch_add(1, memory_order_relaxed);
+        }
+
+        m_references[id] = 1;
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Removes a reference to an ID. Once no references are left, frames with the ID are rejected.
+     *
+     * @remarks Removing an extended ID rebuilds the extended table, as open addressing does not allow removing single entries.
+     */
+    void AcceptanceFilter::removeId(const CanId& canId) {
+        unique_lock<mutex> lock(m_lock);
+        const uint32_t id = normaliseId(static_cast<uint32_t>(canId));
+        auto reference = m_references.find(id);
+
+        if (reference == m_references.end() || --reference->second > 0) { return; }
+
+        m_references.erase(reference);
+
+        if (!(id & CAN_EFF_FLAG)) {
+            m_standardIds[id >> 6].fetch_and(~(1ull << (id & 63)), memory_order_relaxed);
+            return;
+        }
+
+        const uint32_t sequence = m_sequence.load(memory_order_relaxed);
+        m_sequence.store(sequence + 1, memory_order_relaxed);
+        std::atomic_thread_fence(memory_order_release);
+
+        for (size_t i = 0; i < m_extendedSlots; i++) { m_extendedIds[i].store(0, memory_order_relaxed); }
+        for (const auto& x : m_references) {
+            if (x.first & CAN_EFF_FLAG) { insertExtended(x.first & CAN_EFF_MASK); }
+        }
+
+        m_sequence.store(sequence + 2, memory_order_release);
+        m_extendedIdCount.fetch_sub(1, memory_order_relaxed);
+    }
+
+    void AcceptanceFilter::clear() {
+        unique_lock<mutex> lock(m_lock);
+
+        m_references.clear();
+        for (auto& word : m_standardIds) { word.store(0, memory_order_relaxed); }
+
+        const uint32_t sequence = m_sequence.load(memory_order_relaxed);
+        m_sequence.store(sequence + 1, memory_order_relaxed);
+        std::atomic_thread_fence(memory_order_release);
+
+        for (size_t i = 0; i < m_extendedSlots; i++) { m_extendedIds[i].store(0, memory_order_relaxed); }
+
+        m_sequence.store(sequence + 2, memory_order_release);
+        m_extendedIdCount.store(0, memory_order_relaxed);
+    }
+
+    /**
+     * @brief Looks up an extended ID in the hash table.
+     *
+     * @remarks Retries if the table was modified during the lookup. Modifications are rare and short, so this does not starve readers.
+     */
+    bool AcceptanceFilter::acceptsExtended(const uint32_t id) const {
+        const uint32_t wanted = id | SLOT_USED;
+
+        while (true) {
+            const uint32_t sequence = m_sequence.load(memory_order_acquire);
+            if (sequence & 1) { continue; }
+
+            bool found = false;
+            for (size_t i = getSlot(id), probes = 0; probes < m_extendedSlots; i = (i + 1) & (m_extendedSlots - 1), probes++) {
+                const uint32_t slot = m_extendedIds[i].load(memory_order_relaxed);
+
+                if (slot == 0) { break; }
+                if (slot == wanted) {
+                    found = true;
+                    break;
+                }
+            }
+
+            std::atomic_thread_fence(memory_order_acquire);
+            if (m_sequence.load(memory_order_relaxed) == sequence) { return found; }
+        }
+    }
+
+    /**
+     * @brief Inserts an extended ID into the hash table. Must be called within a write section.
+     */
+    void AcceptanceFilter::insertExtended(const uint32_t id) {
+        size_t i = getSlot(id);
+
+        while (m_extendedIds[i].load(memory_order_relaxed) != 0) { i = (i + 1) & (m_extendedSlots - 1); }
+
+        m_extendedIds[i].store(id | SLOT_USED, memory_order_relaxed);
+    }
+
+} /* namespace isotpp */
@@ -0,0 +1,122 @@
+/**
+ * @file AdaptiveFlowControl.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the adaptive flow-control policy.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+// stl
+#include <algorithm>
+
+#include "AdaptiveFlowControl.hpp"
+#include "types/Helpers.hpp"
+
+namespace isotpp {
+
+    using std::unique_lock;
+
+    static const double DRAIN_RATE_WEIGHT = 0.25; //!< The weight of a new drain rate sample
+    static const double MIN_SEPARATION_STEP = 500.0; //!< The STmin (in us) a loss raises a zero STmin to
+
+    AdaptiveFlowControl::AdaptiveFlowControl(const AdaptiveFlowControlConfig& config): m_config(config) {
+        m_config.minBlockSize = std::max<uint8_t>(m_config.minBlockSize, 1);
+        m_config.maxBlockSize = std::max(m_config.maxBlockSize, m_config.minBlockSize);
+        m_config.maxSeparationMicros = std::min<uint32_t>(std::max(m_config.maxSeparationMicros, m_config.minSeparationMicros), 127000);
+    }
+
+    void AdaptiveFlowControl::recordBufferOccupancy(const CanId& session, const size_t bufferedBytes, const size_t capacityBytes) {
+        unique_lock<mutex> lock(m_lock);
+        SessionState& state = getSession(session);
+
+        state.bufferedBytes = bufferedBytes;
+        state.capacityBytes = capacityBytes;
+    }
+
+    void AdaptiveFlowControl::recordConsumed(const CanId& session, const size_t bytes, const uint64_t nowMicros) {
+        unique_lock<mutex> lock(m_lock);
+        SessionState& state = getSession(session);
+
+        if (state.lastConsumedMicros != 0 && nowMicros > state.lastConsumedMicros) {
+            const double sample = static_cast<double>(bytes) / (nowMicros - state.lastConsumedMicros);
+
+            state.drainBytesPerMicro = state.drainBytesPerMicro == 0 ? sample : (1 - DRAIN_RATE_WEIGHT) * state.drainBytesPerMicro + DRAIN_RATE_WEIGHT * sample;
+        }
+
+        state.lastConsumedMicros = nowMicros;
+        state.bufferedBytes -= std::min(bytes, state.bufferedBytes);
+    }
+
+    void AdaptiveFlowControl::recordBlockCompleted(const CanId& session) {
+        unique_lock<mutex> lock(m_lock);
+        SessionState& state = getSession(session);
+
+        if (state.capacityBytes != 0 && state.bufferedBytes > state.capacityBytes * m_config.targetOccupancy) { return; }
+
+        state.blockSize = std::min<double>(state.blockSize + 1, m_config.maxBlockSize);
+        state.separationMicros = std::max<double>(state.separationMicros * 0.75, m_config.minSeparationMicros);
+    }
+
+    void AdaptiveFlowControl::recordFrameLoss(const CanId& session) {
+        unique_lock<mutex> lock(m_lock);
+        SessionState& state = getSession(session);
+
+        state.blockSize = std::max<double>(state.blockSize / 2, m_config.minBlockSize);
+        state.separationMicros = std::min<double>(std::max(state.separationMicros * 2, MIN_SEPARATION_STEP), m_config.maxSeparationMicros);
+    }
+
+    void AdaptiveFlowControl::removeSession(const CanId& session) {
+        unique_lock<mutex> lock(m_lock);
+        m_sessions.erase(static_cast<uint32_t>(session));
+    }
+
+    /**
+     * @brief Derives the values for the session's next FC from the current measurements.
+     *
+     * @param session The session about to send a FC.
+     *
+     * @return FlowControlParameters The flag, block size and raw STmin to send in the FC.
+     */
+    FlowControlParameters AdaptiveFlowControl::getParameters(const CanId& session) {
+        unique_lock<mutex> lock(m_lock);
+        SessionState& state = getSession(session);
+        double separationMicros = state.separationMicros;
+        uint32_t blockSize = std::max<uint32_t>(std::min<uint32_t>(static_cast<uint32_t>(state.blockSize), m_config.maxBlockSize), m_config.minBlockSize);
+
+        if (state.capacityBytes != 0) {
+            const size_t freeBytes = state.capacityBytes - std::min(state.bufferedBytes, state.capacityBytes);
+            const uint32_t freeFrames = freeBytes / types::CONSECUTIVE_FRAME_MAX_DATA;
+
+            if (freeFrames == 0) { return { FlowControlFlag::WAIT, 0, 0 }; }
+
+            // capped after the configured bounds, so a nearly full buffer may get a block below minBlockSize
+            blockSize = std::min(blockSize, freeFrames);
+
+            // above the target, the sender must not outpace the consumer
+            if (state.bufferedBytes > state.capacityBytes * m_config.targetOccupancy && state.drainBytesPerMicro > 0) {
+                separationMicros = std::max(separationMicros, types::CONSECUTIVE_FRAME_MAX_DATA / state.drainBytesPerMicro);
+            }
+        }
+
+        separationMicros = std::min<double>(std::max<double>(separationMicros, m_config.minSeparationMicros), m_config.maxSeparationMicros);
+
+        return { FlowControlFlag::CONTINUE, static_cast<uint8_t>(blockSize), types::microsToSeparationTime(static_cast<uint32_t>(separationMicros)) };
+    }
+
+    /**
+     * @brief Gets a session's state, starting new sessions at the most conservative parameters.
+     */
+    AdaptiveFlowControl::SessionState& AdaptiveFlowControl::getSession(const CanId& session) {
+        const uint32_t key = static_cast<uint32_t>(session);
+        auto state = m_sessions.find(key);
+
+        if (state == m_sessions.end()) {
+            const SessionState initial = { static_cast<double>(m_config.minBlockSize), static_cast<double>(m_config.maxSeparationMicros) / 8, 0, 0, 0, 0 };
+            state = m_sessions.insert(std::make_pair(key, initial)).first;
+        }
+
+        return state->second;
+    }
+
+} /* namespace isotpp */
@@ -0,0 +1,265 @@
+/**
+ * @file BatchClassifier.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the batch classifier.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include "BatchClassifier.hpp"
+#include "Tracepoints.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define ISOTPP_BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+namespace isotpp {
+
+    static const uint8_t CF_TYPE = static_cast<uint8_t>(FrameType::CONSECUTIVE_FRAME);
+
+    #pragma region Kernels
+    /*
+     * Each kernel classifies the frames [begin, end) and returns the index it stopped at; the rest is left to the next
+     * narrower kernel. begin must be at least 1, as every frame is compared with its predecessor.
+     */
+
+    static size_t classifyScalar(const uint8_t* pci, const uint32_t* ids, uint8_t* types, uint8_t* nibbles, uint8_t* continuesRun, size_t begin, const size_t end) {
+        for (; begin < end; begin++) {
+            types[begin] = pci[begin] >> 4;
+            nibbles[begin] = pci[begin] & 0x0f;
+            continuesRun[begin] = types[begin] == CF_TYPE && (pci[begin - 1] >> 4) == CF_TYPE && ids[begin] == ids[begin - 1] &&
+                                  nibbles[begin] == ((pci[begin - 1] + 1) & 0x0f);
+        }
+
+        return end;
+    }
+
+#ifdef ISOTPP_BATCH_X86
+    /**
+     * @brief Compares 16 IDs with their predecessors, yielding 0xff for each equal pair.
+     */
+    __attribute__((target("sse2")))
+    static inline __m128i compareIdsSse2(const uint32_t* ids) {
+        const __m128i eq0 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ids)),      _mm_loadu_si128(reinterpret_cast<const __m128i*>(ids - 1)));
+        const __m128i eq1 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ids + 4)),  _mm_loadu_si128(reinterpret_cast<const __m128i*>(ids + 3)));
+        const __m128i eq2 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ids + 8)),  _mm_loadu_si128(reinterpret_cast<const __m128i*>(ids + 7)));
+        const __m128i eq3 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ids + 12)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(ids + 11)));
+
+        // -1 survives signed saturation, so packing keeps the masks intact
+        return _mm_packs_epi16(_mm_packs_epi32(eq0, eq1), _mm_packs_epi32(eq2, eq3));
+    }
+
+    __attribute__((target("sse2")))
+    static size_t classifySse2(const uint8_t* pci, const uint32_t* ids, uint8_t* types, uint8_t* nibbles, uint8_t* continuesRun, size_t begin, const size_t end) {
+        const __m128i lowNibble = _mm_set1_epi8(0x0f);
+        const __m128i one = _mm_set1_epi8(1);
+        const __m128i cfType = _mm_set1_epi8(CF_TYPE);
+
+        for (; begin + 16 <= end; begin += 16) {
+            const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pci + begin));
+            const __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pci + begin - 1));
+
+            const __m128i type = _mm_and_si128(_mm_srli_epi16(current, 4), lowNibble);
+            const __m128i previousType = _mm_and_si128(_mm_srli_epi16(previous, 4), lowNibble);
+            const __m128i nibble = _mm_and_si128(current, lowNibble);
+            const __m128i expectedNibble = _mm_and_si128(_mm_add_epi8(previous, one), lowNibble);
+
+            __m128i run = _mm_and_si128(_mm_cmpeq_epi8(type, cfType), _mm_cmpeq_epi8(previousType, cfType));
+            run = _mm_and_si128(run, _mm_cmpeq_epi8(nibble, expectedNibble));
+            run = _mm_and_si128(run, compareIdsSse2(ids + begin));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(types + begin), type);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(nibbles + begin), nibble);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(continuesRun + begin), run);
+        }
+
+        return begin;
+    }
+
+    /**
+     * @brief Compares 8 IDs with their predecessors, yielding 0xffffffff for each equal pair.
+     */
+    __attribute__((target("avx2")))
+    static inline __m256i compareIdsAvx2(const uint32_t* ids) {
+        return _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids - 1)));
+    }
+
+    __attribute__((target("avx2")))
+    static size_t classifyAvx2(const uint8_t* pci, const uint32_t* ids, uint8_t* types, uint8_t* nibbles, uint8_t* continuesRun, size_t begin, const size_t end) {
+        const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+        const __m256i one = _mm256_set1_epi8(1);
+        const __m256i cfType = _mm256_set1_epi8(CF_TYPE);
+        // packing works per 128-bit lane; this puts the packed dwords back in frame order
+        const __m256i packOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        for (; begin + 32 <= end; begin += 32) {
+            const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pci + begin));
+            const __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pci + begin - 1));
+
+            const __m256i type = _mm256_and_si256(_mm256_srli_epi16(current, 4), lowNibble);
+            const __m256i previousType = _mm256_and_si256(_mm256_srli_epi16(previous, 4), lowNibble);
+            const __m256i nibble = _mm256_and_si256(current, lowNibble);
+            const __m256i expectedNibble = _mm256_and_si256(_mm256_add_epi8(previous, one), lowNibble);
+
+            const __m256i sameIds = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(
+                _mm256_packs_epi32(compareIdsAvx2(ids + begin),      compareIdsAvx2(ids + begin + 8)),
+                _mm256_packs_epi32(compareIdsAvx2(ids + begin + 16), compareIdsAvx2(ids + begin + 24))
+            ), packOrder);
+
+            __m256i run = _mm256_and_si256(_mm256_cmpeq_epi8(type, cfType), _mm256_cmpeq_epi8(previousType, cfType));
+            run = _mm256_and_si256(run, _mm256_cmpeq_epi8(nibble, expectedNibble));
+            run = _mm256_and_si256(run, sameIds);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(types + begin), type);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(nibbles + begin), nibble);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(continuesRun + begin), run);
+        }
+
+        return begin;
+    }
+#endif // ISOTPP_BATCH_X86
+    #pragma endregion
+
+    BatchClassifier::BatchClassifier(const InstructionSet maxInstructionSet): m_instructionSet(InstructionSet::SCALAR) {
+        m_batch.frames = nullptr;
+        m_batch.count = 0;
+
+#ifdef ISOTPP_BATCH_X86
+        __builtin_cpu_init();
+
+        if (maxInstructionSet >= InstructionSet::AVX2 && __builtin_cpu_supports("avx2")) {
+            m_instructionSet = InstructionSet::AVX2;
+        } else if (maxInstructionSet >= InstructionSet::SSE2 && __builtin_cpu_supports("sse2")) {
+            m_instructionSet = InstructionSet::SSE2;
+        }
+#else
+        (void)maxInstructionSet;
+#endif
+    }
+
+    /**
+     * @brief Classifies a batch of frames.
+     *
+     * @param frames The frames to classify. They must stay valid for as long as the result is used.
+     * @param count The amount of frames.
+     *
+     * @return const ClassifiedFrames& The classification, valid until the next call to classify or ingest.
+     */
+    const ClassifiedFrames& BatchClassifier::classify(const RawCanFrame* frames, const size_t count) {
+        m_batch.frames = frames;
+        m_batch.count = count;
+
+        m_batch.canIds.resize(count);
+        m_batch.frameTypes.resize(count);
+        m_batch.lowNibbles.resize(count);
+        m_batch.continuesRun.resize(count);
+        m_batch.lengths.resize(count);
+        m_pciBytes.resize(count);
+
+        if (count == 0) { return m_batch; }
+
+        // gather the ID and PCI byte of each frame into contiguous arrays
+        const AcceptanceFilter* filter = m_acceptanceFilter.get();
+        for (size_t i = 0; i < count; i++) {
+            const RawCanFrame& frame = frames[i];
+            const bool accepted = frame.length != 0 && (filter == nullptr || filter->accepts(frame.canId));
+
+            m_batch.canIds[i] = frame.canId;
+            m_pciBytes[i] = accepted ? frame.data[0] : REJECTED_FRAME;
+
+            if (accepted) { ISOTPP_TRACE3(frame_ingest, frame.canId, frame.data[0], frame.length); }
+        }
+
+        const uint8_t* pci = m_pciBytes.data();
+        const uint32_t* ids = m_batch.canIds.data();
+        uint8_t* types = m_batch.frameTypes.data();
+        uint8_t* nibbles = m_batch.lowNibbles.data();
+        uint8_t* continuesRun = m_batch.continuesRun.data();
+
+        types[0] = pci[0] >> 4;
+        nibbles[0] = pci[0] & 0x0f;
+        continuesRun[0] = 0;
+
+        size_t next = 1;
+#ifdef ISOTPP_BATCH_X86
+        if (m_instructionSet == InstructionSet::AVX2) { next = classifyAvx2(pci, ids, types, nibbles, continuesRun, next, count); }
+        if (m_instructionSet >= InstructionSet::SSE2) { next = classifySse2(pci, ids, types, nibbles, continuesRun, next, count); }
+#endif
+        classifyScalar(pci, ids, types, nibbles, continuesRun, next, count);
+
+        // the lengths depend on the frame type, so they are resolved per frame, along with marking rejected frames
+        for (size_t i = 0; i < count; i++) {
+            const RawCanFrame& frame = frames[i];
+
+            // the kernels split the substituted PCI byte like any other; an accepted frame may carry the same byte though
+            if (pci[i] == REJECTED_FRAME && (frame.length == 0 || frame.data[0] != REJECTED_FRAME || (filter != nullptr && !filter->accepts(frame.canId)))) {
+                types[i] = REJECTED_FRAME;
+                m_batch.lengths[i] = 0;
+                continue;
+            }
+
+            switch (static_cast<FrameType>(types[i])) {
+                case FrameType::SINGLE_FRAME:
+                    m_batch.lengths[i] = nibbles[i];
+                    break;
+                case FrameType::FIRST_FRAME:
+                    m_batch.lengths[i] = frame.length < 2 ? 0 : static_cast<uint16_t>((nibbles[i] << 8) | frame.data[1]);
+                    break;
+                case FrameType::CONSECUTIVE_FRAME:
+                    m_batch.lengths[i] = frame.length - 1;
+                    break;
+                default:
+                    m_batch.lengths[i] = 0;
+                    break;
+            }
+        }
+
+        return m_batch;
+    }
+
+    /**
+     * @brief Classifies a batch of frames and hands it to the callbacks.
+     *
+     * Runs of in-sequence CFs of one session go to the CF run callback, all other SFs, FFs and FCs to the frame callback.
+     * A CF which breaks the sequence starts a new run, so reassembly sees the error at the start of a run.
+     *
+     * @return size_t The amount of frames handed to the callbacks.
+     */
+    size_t BatchClassifier::ingest(const RawCanFrame* frames, const size_t count) {
+        const ClassifiedFrames& batch = classify(frames, count);
+        size_t dispatched = 0;
+
+        for (size_t i = 0; i < count;) {
+            const uint8_t type = batch.frameTypes[i];
+
+            if (type == CF_TYPE) {
+                size_t runEnd = i + 1;
+                while (runEnd < count && batch.continuesRun[runEnd]) { runEnd++; }
+
+                ISOTPP_TRACE3(cf_run, batch.canIds[i], batch.lowNibbles[i], runEnd - i);
+
+                if (m_cfRunCallback) {
+                    m_cfRunCallback(batch, i, runEnd - i);
+                    dispatched += runEnd - i;
+                }
+
+                i = runEnd;
+                continue;
+            }
+
+            if (type <= static_cast<uint8_t>(FrameType::FLOW_CONTROL_FRAME) && m_frameCallback) {
+                ISOTPP_TRACE3(frame_dispatch, batch.canIds[i], type, batch.lowNibbles[i]);
+                m_frameCallback(batch, i);
+                dispatched++;
+            }
+
+            i++;
+        }
+
+        return dispatched;
+    }
+
+} /* namespace isotpp */
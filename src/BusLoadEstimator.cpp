@@ -0,0 +1,225 @@
+/**
+ * @file BusLoadEstimator.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the bus-load estimator and the transmit rate limiter.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+// stl
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+#include "BusLoadEstimator.hpp"
+
+namespace isotpp {
+
+    using std::unique_lock;
+
+    #pragma region "Bus-load estimator"
+    /**
+     * @throws std::invalid_argument If nominalBitrate is 0.
+     */
+    BusLoadEstimator::BusLoadEstimator(const uint32_t nominalBitrate, const uint32_t dataBitrate, const microseconds& window):
+    m_window({}), m_dataBitrate(dataBitrate == 0 ? nominalBitrate : dataBitrate), m_nominalBitrate(nominalBitrate),
+    m_bucketMicros(std::max<uint64_t>(window.count() / WINDOW_BUCKETS, 1)), m_totalBusTimeNanos(0), m_totalFrames(0) {
+        if (nominalBitrate == 0) { throw std::invalid_argument("The nominal bitrate must not be 0!"); }
+    }
+
+    /**
+     * @brief Computes the worst-case amount of bits a frame occupies on the bus, including the inter-frame space.
+     *
+     * Classic CAN frames consist of SOF, arbitration, control, data and CRC fields, all of which are subject to
+     * bit stuffing, followed by 13 unstuffed bits (CRC delimiter, ACK slot and delimiter, EOF and IFS).
+     * In the worst case, one stuff bit is inserted after the first five bits and after every four bits thereafter.
+     *
+     * CAN FD frames use a 17-bit CRC for up to 16 data bytes and a 21-bit CRC above that. The stuff count and CRC are
+     * not dynamically stuffed; instead a fixed stuff bit precedes the stuff count and follows every four bits.
+     * With BRS set, everything from the BRS bit to the CRC delimiter is sent with the data-phase bitrate.
+     *
+     * @param canId The frame's CAN ID. Determines whether the frame is standard or extended.
+     * @param dataLength The amount of data bytes. CAN FD lengths are rounded up to the next valid frame length.
+     * @param canFd Whether the frame is a CAN FD frame.
+     * @param bitRateSwitch Whether the FD frame's data phase is sent with the data bitrate.
+     *
+     * @return FrameBitCount The amount of bits sent with each bitrate.
+     */
+    FrameBitCount BusLoadEstimator::getFrameBitCount(const CanId& canId, const uint8_t dataLength, const bool canFd, const bool bitRateSwitch) {
+        const bool extended = canId.isExtendedFrame();
+
+        if (!canFd) {
+            const uint32_t dataBits = std::min<uint32_t>(dataLength, CAN_MAX_DLEN) * 8;
+            const uint32_t stuffableBits = (extended ? 54 : 34) + dataBits; // SOF through CRC
+            const uint32_t stuffBits = (stuffableBits - 1) / 4;
+
+            return { stuffableBits + stuffBits + 13, 0 };
+        }
+
+        const uint32_t dataBits = getFdFrameLength(dataLength) * 8;
+        const uint32_t arbitrationBits = extended ? 36 : 17; // SOF through BRS
+        const uint32_t dynamicBits = arbitrationBits + 5 + dataBits; // plus ESI and DLC
+        const uint32_t arbitrationStuffBits = (arbitrationBits - 1) / 4;
+        const uint32_t dataStuffBits = (dynamicBits - 1) / 4 - arbitrationStuffBits;
+        const uint32_t crcBits = dataLength > 16 ? 21 : 17;
+        const uint32_t fixedStuffBits = 2 + (crcBits - 1) / 4;
+        const uint32_t dataPhaseBits = 5 + dataBits + dataStuffBits + 4 + crcBits + fixedStuffBits + 1; // ESI through CRC delimiter
+        const uint32_t trailingBits = 12; // ACK slot and delimiter, EOF and IFS
+
+        if (bitRateSwitch) {
+            return { arbitrationBits + arbitrationStuffBits + trailingBits, dataPhaseBits };
+        }
+
+        return { arbitrationBits + arbitrationStuffBits + dataPhaseBits + trailingBits, 0 };
+    }
+
+    /**
+     * @brief Rounds a data length up to the next length expressible by a CAN FD DLC.
+     *
+     * @param dataLength The amount of data bytes to send.
+     *
+     * @return uint8_t The length of the frame on the bus (0 - 8, 12, 16, 20, 24, 32, 48 or 64).
+     */
+    uint8_t BusLoadEstimator::getFdFrameLength(const uint8_t dataLength) {
+        static const uint8_t FD_LENGTHS[] = { 12, 16, 20, 24, 32, 48, 64 };
+
+        if (dataLength <= CAN_MAX_DLEN) { return dataLength; }
+
+        for (const auto length : FD_LENGTHS) {
+            if (dataLength <= length) { return length; }
+        }
+
+        return CANFD_MAX_DLEN;
+    }
+
+    /**
+     * @brief Computes the worst-case time a frame occupies the bus.
+     *
+     * @return uint64_t The frame's bus time in nanoseconds.
+     */
+    uint64_t BusLoadEstimator::getFrameTimeNanos(const CanId& canId, const uint8_t dataLength, const bool canFd, const bool bitRateSwitch) const {
+        const FrameBitCount bits = getFrameBitCount(canId, dataLength, canFd, bitRateSwitch);
+
+        return (bits.nominalBits * 1000000000ull) / m_nominalBitrate + (bits.dataBits * 1000000000ull) / m_dataBitrate;
+    }
+
+    void BusLoadEstimator::recordFrame(const uint64_t frameTimeNanos, const uint64_t nowMicros) {
+        unique_lock<mutex> lock(m_lock);
+        const uint64_t epoch = nowMicros / m_bucketMicros;
+        WindowBucket& bucket = m_window[epoch % WINDOW_BUCKETS];
+
+        if (bucket.epoch != epoch) {
+            bucket.epoch = epoch;
+            bucket.busTimeNanos = 0;
+        }
+
+        bucket.busTimeNanos += frameTimeNanos;
+        m_totalBusTimeNanos += frameTimeNanos;
+        m_totalFrames++;
+    }
+
+    double BusLoadEstimator::getUtilisation(const uint64_t nowMicros) {
+        unique_lock<mutex> lock(m_lock);
+        const uint64_t epoch = nowMicros / m_bucketMicros;
+        uint64_t busTimeNanos = 0;
+
+        for (const auto& bucket : m_window) {
+            if (bucket.epoch <= epoch && epoch - bucket.epoch < WINDOW_BUCKETS) { busTimeNanos += bucket.busTimeNanos; }
+        }
+
+        return static_cast<double>(busTimeNanos) / (m_bucketMicros * WINDOW_BUCKETS * 1000.0);
+    }
+
+    uint64_t BusLoadEstimator::getTotalFrames() {
+        unique_lock<mutex> lock(m_lock);
+        return m_totalFrames;
+    }
+
+    uint64_t BusLoadEstimator::getTotalBusTimeNanos() {
+        unique_lock<mutex> lock(m_lock);
+        return m_totalBusTimeNanos;
+    }
+    #pragma endregion
+
+    #pragma region "Transmit rate limiter"
+    TransmitRateLimiter::TransmitRateLimiter(const uint32_t nominalBitrate, const uint32_t dataBitrate):
+    m_estimator(nominalBitrate, dataBitrate), m_limited(false), m_share(1.0), m_tokensNanos(0), m_getMicrosCallback(),
+    m_burstNanos(0), m_lastRefillMicros(0), m_throttledFrames(0) {}
+
+    /**
+     * @brief Caps the bus time used by granted frames.
+     *
+     * @param share The share of bus bandwidth which may be used. Values >= 1.0 disable the limit.
+     * @param burst The max. amount of bus time which may be accumulated while idle.
+     */
+    TransmitRateLimiter& TransmitRateLimiter::setBandwidthShare(const double share, const microseconds& burst) {
+        unique_lock<mutex> lock(m_lock);
+
+        m_limited = share < 1.0;
+        m_share = std::max(share, 0.0);
+        m_burstNanos = burst.count() * 1000ull;
+        m_tokensNanos = static_cast<double>(m_burstNanos);
+        m_lastRefillMicros = getMicros();
+
+        return *this;
+    }
+
+    uint64_t TransmitRateLimiter::getThrottledFrames() {
+        unique_lock<mutex> lock(m_lock);
+        return m_throttledFrames;
+    }
+
+    /**
+     * @brief Requests permission to send a frame.
+     *
+     * @return true If the frame may be sent now. Its bus time has been reserved; pass the outcome of the send to @see commit.
+     * @return false If sending the frame would exceed the configured share of the bus. Try again later.
+     */
+    bool TransmitRateLimiter::tryAcquire(const CanId& canId, const uint8_t dataLength, const bool canFd, const bool bitRateSwitch) {
+        const uint64_t frameTimeNanos = m_estimator.getFrameTimeNanos(canId, dataLength, canFd, bitRateSwitch);
+        const uint64_t now = getMicros();
+        unique_lock<mutex> lock(m_lock);
+
+        if (!m_limited) { return true; }
+
+        const uint64_t elapsedMicros = now > m_lastRefillMicros ? now - m_lastRefillMicros : 0;
+        m_lastRefillMicros = now;
+        m_tokensNanos = std::min(m_tokensNanos + elapsedMicros * 1000.0 * m_share, static_cast<double>(m_burstNanos));
+
+        if (m_tokensNanos < 0) {
+            m_throttledFrames++;
+            return false;
+        }
+
+        m_tokensNanos -= frameTimeNanos;
+        return true;
+    }
+
+    /**
+     * @brief Settles a frame granted by @see tryAcquire.
+     *
+     * A sent frame is recorded in the estimator; the bus time reserved for a frame which could not be sent is refunded.
+     *
+     * @param sent Whether the frame was actually handed to the bus.
+     */
+    void TransmitRateLimiter::commit(const CanId& canId, const uint8_t dataLength, const bool sent, const bool canFd, const bool bitRateSwitch) {
+        const uint64_t frameTimeNanos = m_estimator.getFrameTimeNanos(canId, dataLength, canFd, bitRateSwitch);
+
+        if (sent) {
+            m_estimator.recordFrame(frameTimeNanos, getMicros());
+            return;
+        }
+
+        unique_lock<mutex> lock(m_lock);
+        if (m_limited) { m_tokensNanos = std::min(m_tokensNanos + frameTimeNanos, static_cast<double>(m_burstNanos)); }
+    }
+
+    uint64_t TransmitRateLimiter::getMicros() const {
+        if (m_getMicrosCallback) { return m_getMicrosCallback(); }
+
+        return std::chrono::duration_cast<microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    #pragma endregion
+
+} /* namespace isotpp */
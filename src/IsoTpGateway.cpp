@@ -0,0 +1,521 @@
+/**
+ * @file IsoTpGateway.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the cut-through ISOTP gateway.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+// stl
+#include <algorithm>
+#include <utility>
+
+#include "IsoTpGateway.hpp"
+#include "Tracepoints.hpp"
+#include "types/Helpers.hpp"
+
+namespace isotpp {
+
+    using std::unique_lock;
+
+    using types::FrameType;
+
+    void IsoTpGateway::RouteSession::reset() {
+        firstFrame.clear();
+        window.clear();
+        heldFrames.clear();
+
+        active = false;
+        admissionPending = false;
+        senderGranted = false;
+        grantPending = false;
+        waitingForReceiver = false;
+        expectedSequenceNumber = 0;
+        framesLeftInSenderBlock = 0;
+        receiverBlockSize = 0;
+        framesLeftInReceiverBlock = 0;
+        messageLength = 0;
+        bytesReceived = 0;
+        bytesForwarded = 0;
+        receiverSeparationTimeMicros = 0;
+        firstFrameTick = 0;
+        lastSenderFrameTick = 0;
+        nextForwardTick = 0;
+        receiverDeadline = 0;
+    }
+
+    IsoTpGateway::IsoTpGateway(const uint8_t blockSize, const size_t windowFrames):
+    m_timeout(1000), m_windowFrames(std::max<size_t>(windowFrames, std::max<uint8_t>(blockSize, 1))),
+    m_blockSize(std::max<uint8_t>(blockSize, 1)), m_separationTime(0) {}
+
+    /**
+     * @brief Adds a route to the gateway.
+     *
+     * @remarks A peer sends its data and its FCs with the same ID, so the ingress ID of one route is usually the FC ID
+     * of the route in the opposite direction. Frames are told apart by their PCI type.
+     *
+     * @return ReturnValue::SUCCESS if the route was added.
+     * @return ReturnValue::ERROR if another route already receives data, or FCs, with the same ID on the same bus.
+     * @return ReturnValue::BUFFER_FULL if the acceptance filter cannot hold any more extended IDs.
+     */
+    ReturnValue IsoTpGateway::addRoute(const GatewayRoute& route) {
+        unique_lock<mutex> lock(m_lock);
+        const BusSide egress = route.ingress == BusSide::BUS_A ? BusSide::BUS_B : BusSide::BUS_A;
+        const uint64_t senderKey = getRouteKey(route.ingress, route.ingressRxId);
+        const uint64_t flowControlKey = getRouteKey(egress, route.egressRxId);
+
+        if (m_senderRoutes.count(senderKey) || m_flowControlRoutes.count(flowControlKey)) { return ReturnValue::ERROR; }
+
+        if (m_acceptanceFilters[static_cast<size_t>(route.ingress)].addId(route.ingressRxId) != ReturnValue::SUCCESS) {
+            return ReturnValue::BUFFER_FULL;
+        }
+        if (m_acceptanceFilters[static_cast<size_t>(egress)].addId(route.egressRxId) != ReturnValue::SUCCESS) {
+            m_acceptanceFilters[static_cast<size_t>(route.ingress)].removeId(route.ingressRxId);
+            return ReturnValue::BUFFER_FULL;
+        }
+
+        m_sessions.push_back(RouteSession(route));
+        m_senderRoutes[senderKey] = m_sessions.size() - 1;
+        m_flowControlRoutes[flowControlKey] = m_sessions.size() - 1;
+
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Removes a route from the gateway and drops its IDs from the acceptance filters.
+     *
+     * @remarks A transfer still in progress on the route is aborted; the sender is told so with FC ABORT.
+     *
+     * @param ingress The bus the route's messages arrive on.
+     * @param ingressRxId The ID the route's SF/FF/CFs arrive with.
+     *
+     * @return ReturnValue::SUCCESS if the route was removed.
+     * @return ReturnValue::NO_ROUTE if no route receives data with ingressRxId on the ingress bus.
+     */
+    ReturnValue IsoTpGateway::removeRoute(const BusSide ingress, const CanId& ingressRxId) {
+        unique_lock<mutex> lock(m_lock);
+        const auto route = m_senderRoutes.find(getRouteKey(ingress, ingressRxId));
+
+        if (route == m_senderRoutes.end()) { return ReturnValue::NO_ROUTE; }
+
+        const size_t index = route->second;
+        RouteSession& session = m_sessions[index];
+        const BusSide egress = getEgress(session);
+
+        if (session.active && session.bytesReceived < session.messageLength) {
+            sendFlowControl(session, FlowControlFlag::ABORT_TRANSMISSION);
+        }
+        endTransfer(session);
+
+        m_senderRoutes.erase(route);
+        m_flowControlRoutes.erase(getRouteKey(egress, session.route.egressRxId));
+        m_acceptanceFilters[static_cast<size_t>(ingress)].removeId(session.route.ingressRxId);
+        m_acceptanceFilters[static_cast<size_t>(egress)].removeId(session.route.egressRxId);
+
+        // the last session takes the removed one's place, so only its index changes
+        const size_t last = m_sessions.size() - 1;
+        if (index != last) {
+            const GatewayRoute& moved = m_sessions[last].route;
+
+            m_senderRoutes[getRouteKey(moved.ingress, moved.ingressRxId)] = index;
+            m_flowControlRoutes[getRouteKey(getEgress(m_sessions[last]), moved.egressRxId)] = index;
+            m_sessions[index] = std::move(m_sessions[last]);
+        }
+        m_sessions.pop_back();
+
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Handles a frame received on either bus.
+     *
+     * @param side The bus the frame was received on.
+     * @param canId The frame's CAN ID.
+     * @param frame The frame's data.
+     *
+     * @return ReturnValue::SUCCESS if the frame was forwarded, buffered or applied.
+     * @return ReturnValue::NO_ROUTE if the frame's ID is not routed on this bus.
+     * @return ReturnValue::UNEXPECTED_FRAME if the frame does not fit the route's current state. The transfer is aborted on SN errors.
+     * @return ReturnValue::INVALID_LENGTH if the frame is too short for its type, or longer than a classic CAN frame.
+     * @return ReturnValue::OVERFLOW if the receiver rejected the message. The rejection was relayed to the sender.
+     * @return ReturnValue::BUFFER_FULL if the sender sent more SFs than can be held while its last message is forwarded.
+     * @return ReturnValue::ERROR if forwarding failed. The transfer is aborted.
+     */
+    ReturnValue IsoTpGateway::handleIncomingCanFrame(const BusSide side, const CanId& canId, const buf_t& frame) {
+        if (!m_acceptanceFilters[static_cast<size_t>(side)].accepts(canId)) { return ReturnValue::NO_ROUTE; }
+
+        unique_lock<mutex> lock(m_lock);
+        const uint64_t key = getRouteKey(side, canId);
+        const uint64_t now = getTick();
+        ReturnValue returnVal = ReturnValue::NO_ROUTE;
+        RouteSession* session = nullptr;
+
+        if (frame.empty() || frame.size() > CAN_MAX_DLEN) { return ReturnValue::INVALID_LENGTH; }
+
+        ISOTPP_TRACE3(frame_ingest, static_cast<uint32_t>(canId), frame[0], frame.size());
+
+        // the same ID may carry one route's data and another route's FCs
+        if (types::getFrameType(frame[0]) == FrameType::FLOW_CONTROL_FRAME) {
+            const auto route = m_flowControlRoutes.find(key);
+            if (route != m_flowControlRoutes.end()) {
+                session = &m_sessions[route->second];
+                returnVal = handleReceiverFlowControl(*session, frame, now);
+            }
+        } else {
+            const auto route = m_senderRoutes.find(key);
+            if (route != m_senderRoutes.end()) {
+                session = &m_sessions[route->second];
+                returnVal = handleSenderFrame(*session, frame, now);
+            }
+        }
+
+        if (session != nullptr) { pump(*session, now); }
+
+        return returnVal;
+    }
+
+    /**
+     * @brief Forwards due frames on all routes and aborts transfers whose peers stopped responding.
+     *
+     * @return size_t The amount of frames forwarded.
+     */
+    size_t IsoTpGateway::poll() {
+        unique_lock<mutex> lock(m_lock);
+        const uint64_t now = getTick();
+        const uint64_t timeout = m_timeout.count();
+        size_t forwarded = 0;
+
+        for (auto& session : m_sessions) {
+            if (!session.active) { continue; }
+
+            if (session.admissionPending) {
+                // the sender expects the next FC within N_Bs, so the budget is asked again before it gives up
+                if (now - session.lastSenderFrameTick >= timeout / 2 && admitFirstFrame(session, session.firstFrame, now) == ReturnValue::SUCCESS &&
+                    !session.admissionPending) {
+                    forwarded++;
+                }
+                continue;
+            }
+
+            if (session.waitingForReceiver && now >= session.receiverDeadline) {
+                ISOTPP_TRACE2(timeout, static_cast<uint32_t>(session.route.egressTxId), ISOTPP_TIMEOUT_N_BS);
+
+                // the receiver stopped responding (N_Bs); stop the sender as well
+                if (session.bytesReceived < session.messageLength) {
+                    sendFlowControl(session, FlowControlFlag::ABORT_TRANSMISSION);
+                }
+                finishTransfer(session, now);
+                continue;
+            }
+
+            if (!session.heldFrames.empty() && types::getFrameType(session.heldFrames.back()[0]) == FrameType::FIRST_FRAME &&
+                now - session.lastSenderFrameTick >= timeout / 2) {
+                // keep the sender of the held FF waiting (N_Bs)
+                sendFlowControl(session, FlowControlFlag::WAIT);
+                session.lastSenderFrameTick = now;
+            }
+
+            if (session.senderGranted && session.bytesReceived < session.messageLength && now - session.lastSenderFrameTick >= timeout / 2) {
+                if (session.grantPending) {
+                    // keep the sender alive while the window drains (N_Br)
+                    sendFlowControl(session, FlowControlFlag::WAIT);
+                    session.lastSenderFrameTick = now;
+                } else if (now - session.lastSenderFrameTick >= timeout) {
+                    ISOTPP_TRACE2(timeout, static_cast<uint32_t>(session.route.ingressRxId), ISOTPP_TIMEOUT_N_CR);
+                    endTransfer(session); // the sender stopped sending (N_Cr)
+                    continue;
+                }
+            }
+
+            forwarded += pump(session, now);
+        }
+
+        return forwarded;
+    }
+
+    /**
+     * @brief Gets the payload length of the next consecutive frame of a message.
+     */
+    uint16_t IsoTpGateway::getPayloadLength(const RouteSession& session, const uint16_t bytesSoFar) {
+        return std::min<uint16_t>(session.messageLength - bytesSoFar, types::CONSECUTIVE_FRAME_MAX_DATA);
+    }
+
+    bool IsoTpGateway::send(const BusSide side, const CanId& canId, const buf_t& frame) {
+        const sendcancb_t& callback = m_sendCanCallbacks[static_cast<size_t>(side)];
+
+        return callback && callback(canId, frame);
+    }
+
+    bool IsoTpGateway::sendFlowControl(const RouteSession& session, const FlowControlFlag flag, const uint8_t blockSize, const uint8_t separationTime) {
+        ISOTPP_TRACE4(fc_send, static_cast<uint32_t>(session.route.ingressRxId), static_cast<uint8_t>(flag), blockSize, separationTime);
+
+        return send(session.route.ingress, session.route.ingressTxId, types::makeFlowControlFrame(flag, blockSize, separationTime));
+    }
+
+    /**
+     * @brief Ends the route's current transfer, if any, and returns its reservation to the budget.
+     */
+    void IsoTpGateway::endTransfer(RouteSession& session) {
+        if (session.active && m_reassemblyBudget) { m_reassemblyBudget->release(getRouteKey(session.route.ingress, session.route.ingressRxId)); }
+
+        session.reset();
+    }
+
+    /**
+     * @brief Ends the route's current transfer and starts on the frames the sender sent in the meantime.
+     */
+    void IsoTpGateway::finishTransfer(RouteSession& session, const uint64_t now) {
+        deque<buf_t> heldFrames;
+        heldFrames.swap(session.heldFrames);
+
+        endTransfer(session);
+
+        // only the last held frame can be a FF, so the frames before it are complete messages
+        for (const auto& frame : heldFrames) { handleSenderFrame(session, frame, now); }
+    }
+
+    /**
+     * @brief Asks the reassembly budget whether the FF may be forwarded, and answers the sender accordingly.
+     *
+     * @param frame The FF. Copied into the session if admission has to be retried.
+     *
+     * @return ReturnValue::SUCCESS if the FF was forwarded, or held back and the sender was answered with FC WAIT.
+     * @return ReturnValue::OVERFLOW if the budget rejected the message. The sender was answered with FC OVERFLOW.
+     * @return ReturnValue::ERROR if forwarding failed. The transfer is aborted.
+     */
+    ReturnValue IsoTpGateway::admitFirstFrame(RouteSession& session, const buf_t& frame, const uint64_t now) {
+        const FlowControlFlag admission = m_reassemblyBudget ? m_reassemblyBudget->admit(getRouteKey(session.route.ingress, session.route.ingressRxId), session.messageLength) : FlowControlFlag::CONTINUE;
+
+        switch (admission) {
+            case FlowControlFlag::CONTINUE:
+                return forwardFirstFrame(session, frame, now);
+            case FlowControlFlag::WAIT:
+                if (!session.admissionPending) {
+                    session.firstFrame = frame;
+                    session.admissionPending = true;
+                }
+                session.lastSenderFrameTick = now;
+
+                sendFlowControl(session, FlowControlFlag::WAIT);
+                return ReturnValue::SUCCESS;
+            case FlowControlFlag::ABORT_TRANSMISSION:
+            default:
+                sendFlowControl(session, FlowControlFlag::ABORT_TRANSMISSION);
+                session.reset(); // nothing was reserved
+                return ReturnValue::OVERFLOW;
+        }
+    }
+
+    /**
+     * @brief Forwards an admitted FF to the receiver.
+     */
+    ReturnValue IsoTpGateway::forwardFirstFrame(RouteSession& session, const buf_t& frame, const uint64_t now) {
+        if (!send(getEgress(session), session.route.egressTxId, frame)) {
+            endTransfer(session);
+            return ReturnValue::ERROR;
+        }
+
+        ISOTPP_TRACE4(frame_send, static_cast<uint32_t>(session.route.egressTxId), static_cast<uint8_t>(FrameType::FIRST_FRAME), 0, 0);
+
+        session.admissionPending = false;
+        session.firstFrame.clear();
+        session.waitingForReceiver = true;
+        session.expectedSequenceNumber = 1;
+        session.bytesReceived = types::FIRST_FRAME_DATA;
+        session.bytesForwarded = types::FIRST_FRAME_DATA;
+        session.receiverDeadline = now + m_timeout.count();
+
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Handles a SF, FF or CF received from the sender of a route.
+     */
+    ReturnValue IsoTpGateway::handleSenderFrame(RouteSession& session, const buf_t& frame, const uint64_t now) {
+        const BusSide egress = getEgress(session);
+
+        ISOTPP_TRACE3(frame_dispatch, static_cast<uint32_t>(session.route.ingressRxId), static_cast<uint8_t>(frame[0] >> 4), static_cast<uint8_t>(frame[0] & 0x0f));
+
+        switch (types::getFrameType(frame[0])) {
+            case FrameType::SINGLE_FRAME:
+                if (session.active && session.bytesReceived >= session.messageLength) { return holdSenderFrame(session, frame, now); }
+
+                endTransfer(session); // a new message aborts the current one
+                if (!send(egress, session.route.egressTxId, frame)) { return ReturnValue::ERROR; }
+
+                ISOTPP_TRACE4(frame_send, static_cast<uint32_t>(session.route.egressTxId), static_cast<uint8_t>(FrameType::SINGLE_FRAME), 0, 0);
+                return ReturnValue::SUCCESS;
+            case FrameType::FIRST_FRAME: {
+                if (frame.size() < CAN_MAX_DLEN) { return ReturnValue::INVALID_LENGTH; }
+
+                const uint16_t length = ((frame[0] & 0x0f) << 8) | frame[1];
+                if (length <= types::SINGLE_FRAME_MAX_DATA) { return ReturnValue::INVALID_LENGTH; }
+
+                if (session.active && session.bytesReceived >= session.messageLength) { return holdSenderFrame(session, frame, now); }
+
+                if (session.admissionPending) {
+                    // the sender repeated its FF while waiting for admission; the budget keeps counting its waits
+                    session.firstFrame = frame;
+                } else {
+                    endTransfer(session); // a new message aborts the current one
+
+                    session.active = true;
+                    session.firstFrameTick = now;
+                }
+
+                session.messageLength = length;
+                session.lastSenderFrameTick = now;
+
+                return admitFirstFrame(session, frame, now);
+            }
+            case FrameType::CONSECUTIVE_FRAME: {
+                if (!session.active || !session.senderGranted || session.grantPending) { return ReturnValue::UNEXPECTED_FRAME; }
+
+                const uint16_t length = getPayloadLength(session, session.bytesReceived);
+                if (frame.size() < length + 1u) {
+                    endTransfer(session);
+                    return ReturnValue::INVALID_LENGTH;
+                }
+
+                if ((frame[0] & 0x0f) != session.expectedSequenceNumber) {
+                    endTransfer(session);
+                    return ReturnValue::UNEXPECTED_FRAME;
+                }
+
+                if (session.window.size() >= m_windowFrames) { return ReturnValue::BUFFER_FULL; } // unreachable, blocks are only granted with room to spare
+
+                session.window.push_back(frame);
+                session.bytesReceived += length;
+                session.expectedSequenceNumber = (session.expectedSequenceNumber + 1) & 0x0f;
+                session.lastSenderFrameTick = now;
+
+                if (session.bytesReceived < session.messageLength && --session.framesLeftInSenderBlock == 0) {
+                    session.grantPending = true;
+
+                    if (m_windowFrames - session.window.size() < m_blockSize) {
+                        sendFlowControl(session, FlowControlFlag::WAIT);
+                    }
+                }
+
+                return ReturnValue::SUCCESS;
+            }
+            default:
+                return ReturnValue::UNEXPECTED_FRAME;
+        }
+    }
+
+    /**
+     * @brief Holds back a SF or FF the sender sent after completing its message, until that message is forwarded.
+     *
+     * @remarks A held FF is superseded by any frame sent after it, as the sender abandoned it.
+     */
+    ReturnValue IsoTpGateway::holdSenderFrame(RouteSession& session, const buf_t& frame, const uint64_t now) {
+        if (!session.heldFrames.empty() && types::getFrameType(session.heldFrames.back()[0]) == FrameType::FIRST_FRAME) {
+            session.heldFrames.pop_back();
+        }
+        if (session.heldFrames.size() >= m_windowFrames) { return ReturnValue::BUFFER_FULL; }
+
+        session.heldFrames.push_back(frame);
+
+        if (types::getFrameType(frame[0]) == FrameType::FIRST_FRAME) {
+            sendFlowControl(session, FlowControlFlag::WAIT);
+            session.lastSenderFrameTick = now;
+        }
+
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Handles a FC received from the receiver of a route.
+     *
+     * @remarks The receiver's response to the first frame is relayed to the sender.
+     */
+    ReturnValue IsoTpGateway::handleReceiverFlowControl(RouteSession& session, const buf_t& frame, const uint64_t now) {
+        if (types::getFrameType(frame[0]) != FrameType::FLOW_CONTROL_FRAME || !session.active || !session.waitingForReceiver) {
+            return ReturnValue::UNEXPECTED_FRAME;
+        }
+        if (frame.size() < 3) { return ReturnValue::INVALID_LENGTH; }
+
+        ISOTPP_TRACE5(fc_receive, static_cast<uint32_t>(session.route.egressTxId), static_cast<uint8_t>(frame[0] & 0x0f), frame[1], frame[2], now + m_timeout.count() - session.receiverDeadline);
+
+        switch (static_cast<FlowControlFlag>(frame[0] & 0x0f)) {
+            case FlowControlFlag::CONTINUE:
+                session.waitingForReceiver = false;
+                session.receiverBlockSize = frame[1];
+                session.framesLeftInReceiverBlock = frame[1];
+                session.receiverSeparationTimeMicros = types::separationTimeToMicros(frame[2]);
+                session.nextForwardTick = now; // STmin only applies between consecutive frames
+
+                if (!session.senderGranted) { grantSender(session, now); }
+                return ReturnValue::SUCCESS;
+            case FlowControlFlag::WAIT:
+                session.receiverDeadline = now + m_timeout.count();
+
+                if (!session.senderGranted) {
+                    sendFlowControl(session, FlowControlFlag::WAIT);
+                }
+                return ReturnValue::SUCCESS;
+            case FlowControlFlag::ABORT_TRANSMISSION:
+            default:
+                if (session.bytesReceived < session.messageLength) {
+                    sendFlowControl(session, FlowControlFlag::ABORT_TRANSMISSION);
+                }
+
+                finishTransfer(session, now);
+                return ReturnValue::OVERFLOW;
+        }
+    }
+
+    /**
+     * @brief Forwards buffered CFs to the receiver as far as its flow control allows and grants the sender's next block once there is room.
+     *
+     * @return size_t The amount of frames forwarded.
+     */
+    size_t IsoTpGateway::pump(RouteSession& session, const uint64_t now) {
+        const BusSide egress = getEgress(session);
+        size_t forwarded = 0;
+
+        while (session.active && !session.waitingForReceiver && !session.window.empty() && now >= session.nextForwardTick) {
+            if (!send(egress, session.route.egressTxId, session.window.front())) {
+                finishTransfer(session, now);
+                return forwarded;
+            }
+
+            ISOTPP_TRACE4(frame_send, static_cast<uint32_t>(session.route.egressTxId), static_cast<uint8_t>(FrameType::CONSECUTIVE_FRAME), static_cast<uint8_t>(session.window.front()[0] & 0x0f), session.bytesForwarded);
+
+            session.bytesForwarded += getPayloadLength(session, session.bytesForwarded);
+            session.window.pop_front();
+            forwarded++;
+
+            if (session.bytesForwarded >= session.messageLength) {
+                ISOTPP_TRACE4(message_complete, static_cast<uint32_t>(session.route.egressTxId), session.messageLength, static_cast<int32_t>(ReturnValue::SUCCESS), now - session.firstFrameTick);
+                finishTransfer(session, now);
+            } else if (session.receiverBlockSize != 0 && --session.framesLeftInReceiverBlock == 0) {
+                session.waitingForReceiver = true;
+                session.receiverDeadline = now + m_timeout.count();
+            } else {
+                session.nextForwardTick = now + (session.receiverSeparationTimeMicros + 999) / 1000;
+            }
+        }
+
+        if (session.active && session.grantPending && m_windowFrames - session.window.size() >= m_blockSize) {
+            grantSender(session, now);
+        }
+
+        return forwarded;
+    }
+
+    /**
+     * @brief Allows the sender to send the next block.
+     */
+    void IsoTpGateway::grantSender(RouteSession& session, const uint64_t now) {
+        session.senderGranted = true;
+        session.grantPending = false;
+        session.framesLeftInSenderBlock = m_blockSize;
+        session.lastSenderFrameTick = now;
+
+        sendFlowControl(session, FlowControlFlag::CONTINUE, m_blockSize, m_separationTime);
+    }
+
+} /* namespace isotpp */
@@ -0,0 +1,143 @@
+/**
+ * @file LatencyPoller.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the low-latency busy-polling service.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+// stl
+#include <algorithm>
+#include <future>
+
+// libc
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "LatencyPoller.hpp"
+
+namespace isotpp {
+
+    using std::promise;
+    using std::unique_lock;
+
+    LatencyPoller::LatencyPoller(const pollcb_t& pollCallback): m_keepPollerAlive(false), m_backoffs(0), m_iterations(0), m_pollCallback(pollCallback) {}
+
+    /**
+     * @brief Starts the poller thread with the given configuration.
+     *
+     * @remarks The CPU affinity and scheduling policy are applied by the poller thread itself, before its first poll.
+     *
+     * @return ReturnValue::SUCCESS if the poller is running.
+     * @return ReturnValue::IN_PROGRESS if the poller is already running.
+     * @return ReturnValue::ERROR if the thread could not be pinned or switched to SCHED_FIFO; errno is set in the calling thread. The poller is not running.
+     */
+    ReturnValue LatencyPoller::start(const LatencyPollerConfig& config) {
+        unique_lock<mutex> lock(m_lock);
+
+        if (m_keepPollerAlive) { return ReturnValue::IN_PROGRESS; }
+        if (!m_pollCallback) { return ReturnValue::ERROR; }
+
+        promise<int> configured{}; // errno is thread-local, so the poller thread passes its error code back
+        auto result = configured.get_future();
+
+        m_iterations = 0;
+        m_backoffs = 0;
+        m_keepPollerAlive = true;
+        m_pollerThread = thread([this, config, &configured]() {
+            const int error = applyThreadConfig(config);
+            configured.set_value(error);
+
+            if (error == 0) { run(config); }
+        });
+
+        const int error = result.get();
+
+        if (error != 0) {
+            m_keepPollerAlive = false;
+            m_pollerThread.join();
+
+            errno = error;
+            return ReturnValue::ERROR;
+        }
+
+        return ReturnValue::SUCCESS;
+    }
+
+    void LatencyPoller::stop() {
+        unique_lock<mutex> lock(m_lock);
+
+        m_keepPollerAlive = false;
+        if (m_pollerThread.joinable()) { m_pollerThread.join(); }
+    }
+
+    /**
+     * @brief Applies the CPU affinity and scheduling policy to the calling thread.
+     *
+     * @return int 0 on success, otherwise the errno value describing the failure.
+     */
+    int LatencyPoller::applyThreadConfig(const LatencyPollerConfig& config) {
+        #if defined(__linux__)
+        if (config.cpu >= CPU_SETSIZE) { return EINVAL; } // CPU_SET() is undefined beyond the set
+
+        if (config.cpu >= 0) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(config.cpu, &cpus);
+
+            const int error = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+            if (error != 0) { return error; }
+        }
+        #else
+        if (config.cpu >= 0) { return ENOTSUP; }
+        #endif
+
+        if (config.realtime) {
+            sched_param param{};
+            param.sched_priority = std::min(std::max(config.realtimePriority, sched_get_priority_min(SCHED_FIFO)), sched_get_priority_max(SCHED_FIFO));
+
+            const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+            if (error != 0) { return error; }
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Hints the CPU that the thread is spinning, without giving up the time slice.
+     */
+    void LatencyPoller::cpuRelax() {
+        #if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+        #elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+        #endif
+    }
+
+    void LatencyPoller::run(const LatencyPollerConfig config) {
+        uint32_t idlePolls = 0;
+        microseconds backoff(1);
+
+        while (m_keepPollerAlive) {
+            m_iterations++;
+
+            if (m_pollCallback()) {
+                idlePolls = 0;
+                backoff = microseconds(1);
+                continue;
+            }
+
+            if (++idlePolls < config.spinIterations || config.maxBackoff.count() == 0) {
+                cpuRelax();
+                continue;
+            }
+
+            m_backoffs++;
+            std::this_thread::sleep_for(backoff);
+            backoff = std::min(backoff * 2, config.maxBackoff);
+        }
+    }
+
+} /* namespace isotpp */
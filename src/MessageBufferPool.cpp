@@ -0,0 +1,160 @@
+/**
+ * @file MessageBufferPool.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the reassembly buffer pool.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+// stl
+#include <utility>
+
+#include "MessageBufferPool.hpp"
+
+namespace isotpp {
+
+    using std::unique_lock;
+
+    /**
+     * @brief Places the control blocks of lent buffers in the pool's preallocated slots.
+     *
+     * Holds a reference to the pool state, as the control block is deallocated after its deleter has been destroyed.
+     */
+    template<typename T>
+    struct MessageBufferPool::ControlBlockAllocator {
+        using value_type = T;
+
+        template<typename U>
+        struct rebind { using other = ControlBlockAllocator<U>; };
+
+        explicit ControlBlockAllocator(const shared_ptr<PoolState>& state): state(state) {}
+
+        template<typename U>
+        ControlBlockAllocator(const ControlBlockAllocator<U>& other): state(other.state) {}
+
+        T* allocate(const size_t count) {
+            static_assert(sizeof(T) <= CONTROL_BLOCK_SIZE && alignof(T) <= alignof(ControlBlockSlot), "CONTROL_BLOCK_SIZE is too small for this standard library's control block");
+
+            if (count == 1) {
+                unique_lock<mutex> lock(state->lock);
+
+                if (!state->availableControlBlocks.empty()) {
+                    void* slot = state->availableControlBlocks.back();
+                    state->availableControlBlocks.pop_back();
+
+                    return static_cast<T*>(slot);
+                }
+            }
+
+            return static_cast<T*>(::operator new(count * sizeof(T))); // only while weak_ptrs keep control blocks alive
+        }
+
+        void deallocate(T* ptr, const size_t) {
+            const ControlBlockSlot* slots = state->controlBlocks.data();
+            const ControlBlockSlot* slot = reinterpret_cast<const ControlBlockSlot*>(ptr);
+
+            if (slot >= slots && slot < slots + state->controlBlocks.size()) {
+                unique_lock<mutex> lock(state->lock);
+                state->availableControlBlocks.push_back(ptr);
+            } else {
+                ::operator delete(ptr);
+            }
+        }
+
+        template<typename U>
+        bool operator==(const ControlBlockAllocator<U>& other) const { return state == other.state; }
+        template<typename U>
+        bool operator!=(const ControlBlockAllocator<U>& other) const { return state != other.state; }
+
+        shared_ptr<PoolState> state;
+    };
+
+    MessageBufferPool::MessageBufferPool(const size_t capacity, const size_t reserveBytes): m_state(new PoolState()), m_capacity(capacity) {
+        m_state->storage.reserve(capacity);
+        m_state->available.reserve(capacity);
+        m_state->controlBlocks.resize(capacity);
+        m_state->availableControlBlocks.reserve(capacity);
+
+        for (size_t i = 0; i < capacity; i++) {
+            unique_ptr<buf_t> buffer(new buf_t());
+            buffer->reserve(reserveBytes);
+
+            m_state->available.push_back(buffer.get());
+            m_state->storage.push_back(std::move(buffer));
+            m_state->availableControlBlocks.push_back(&m_state->controlBlocks[i]);
+        }
+    }
+
+    /**
+     * @brief Lends a buffer for reassembly.
+     *
+     * @return shared_ptr<buf_t> A cleared buffer, which is returned to the pool once all references are dropped.
+     * Empty if every buffer is currently in use.
+     */
+    shared_ptr<buf_t> MessageBufferPool::acquire() {
+        const shared_ptr<PoolState> state = m_state;
+        buf_t* buffer = nullptr;
+
+        {
+            unique_lock<mutex> lock(state->lock);
+            if (state->available.empty()) { return {}; }
+
+            buffer = state->available.back();
+            state->available.pop_back();
+        }
+
+        return shared_ptr<buf_t>(buffer, [state](buf_t* x) {
+            x->clear(); // keeps the capacity
+
+            unique_lock<mutex> lock(state->lock);
+            state->available.push_back(x);
+        }, ControlBlockAllocator<buf_t>(state));
+    }
+
+    /**
+     * @brief Publishes a reassembled message.
+     *
+     * @remarks This does not copy the message; the engine's reference is moved into the handle and reset.
+     *
+     * @param buffer The buffer lent by @see acquire. Is empty after the call.
+     *
+     * @return msghandle_t An immutable handle to the message.
+     */
+    msghandle_t MessageBufferPool::publish(shared_ptr<buf_t>& buffer) {
+        msghandle_t handle(std::move(buffer));
+        buffer.reset();
+
+        return handle;
+    }
+
+    /**
+     * @brief Publishes a reassembled message and passes it to every registered consumer.
+     *
+     * @param canId The CAN ID the message was received with.
+     * @param buffer The buffer lent by @see acquire. Is empty after the call.
+     *
+     * @return size_t The amount of consumers the message was passed to.
+     */
+    size_t MessageBufferPool::deliver(const CanId& canId, shared_ptr<buf_t>& buffer) {
+        const msghandle_t handle = publish(buffer);
+        unique_lock<mutex> lock(m_consumerLock);
+
+        for (const auto& consumer : m_consumers) { consumer(canId, handle); }
+
+        return m_consumers.size();
+    }
+
+    MessageBufferPool& MessageBufferPool::addConsumer(const msgcb_t& val) {
+        unique_lock<mutex> lock(m_consumerLock);
+        m_consumers.push_back(val);
+
+        return *this;
+    }
+
+    size_t MessageBufferPool::getAvailable() {
+        unique_lock<mutex> lock(m_state->lock);
+        return m_state->available.size();
+    }
+
+} /* namespace isotpp */
@@ -0,0 +1,97 @@
+/**
+ * @file PeerParameterCache.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the peer parameter cache.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include "PeerParameterCache.hpp"
+#include "types/Helpers.hpp"
+
+namespace isotpp {
+
+    using std::unique_lock;
+
+    PeerParameterCache::PeerParameterCache(const size_t maxPeers, const milliseconds& maxAge): m_maxAge(maxAge), m_maxPeers(maxPeers) {}
+
+    /**
+     * @brief Records a flow-control frame received from a peer.
+     *
+     * @param peer The CAN ID messages are sent to the peer with.
+     * @param blockSize The BS granted.
+     * @param separationTime The raw STmin requested.
+     * @param responseTime The ticks between the FF (or the last CF of a block) and the FC.
+     * @param now The current tick.
+     */
+    void PeerParameterCache::recordFlowControl(const CanId& peer, const uint8_t blockSize, const uint8_t separationTime, const uint32_t responseTime, const uint64_t now) {
+        if (m_maxPeers == 0) { return; }
+
+        unique_lock<mutex> lock(m_lock);
+        const uint32_t key = static_cast<uint32_t>(peer);
+        auto entry = m_peers.find(key);
+
+        if (entry == m_peers.end()) {
+            if (m_peers.size() >= m_maxPeers) {
+                auto oldest = m_peers.begin();
+                for (auto it = m_peers.begin(); it != m_peers.end(); it++) {
+                    if (it->second.lastUpdated < oldest->second.lastUpdated) { oldest = it; }
+                }
+                m_peers.erase(oldest);
+            }
+
+            entry = m_peers.insert(std::make_pair(key, PeerParameters{ 0, 0, 0, 0, responseTime, 0, 0 })).first;
+        }
+
+        auto& parameters = entry->second;
+        parameters.blockSize = blockSize;
+        parameters.separationTime = separationTime;
+        parameters.separationTimeMicros = types::separationTimeToMicros(separationTime);
+        parameters.lastResponseTime = responseTime;
+        parameters.averageResponseTime = (parameters.averageResponseTime * 3 + responseTime) / 4;
+        parameters.samples++;
+        parameters.lastUpdated = now;
+    }
+
+    /**
+     * @brief Gets the parameters last recorded for a peer.
+     *
+     * @param peer The CAN ID messages are sent to the peer with.
+     * @param now The current tick.
+     * @param parameters Out: the recorded parameters.
+     *
+     * @return true if the peer is known and its entry has not expired.
+     */
+    bool PeerParameterCache::lookup(const CanId& peer, const uint64_t now, PeerParameters& parameters) {
+        unique_lock<mutex> lock(m_lock);
+        const auto entry = m_peers.find(static_cast<uint32_t>(peer));
+
+        if (entry == m_peers.end()) { return false; }
+
+        if (now > entry->second.lastUpdated && now - entry->second.lastUpdated > static_cast<uint64_t>(m_maxAge.count())) {
+            m_peers.erase(entry);
+            return false;
+        }
+
+        parameters = entry->second;
+        return true;
+    }
+
+    void PeerParameterCache::invalidate(const CanId& peer) {
+        unique_lock<mutex> lock(m_lock);
+        m_peers.erase(static_cast<uint32_t>(peer));
+    }
+
+    void PeerParameterCache::clear() {
+        unique_lock<mutex> lock(m_lock);
+        m_peers.clear();
+    }
+
+    size_t PeerParameterCache::getSize() {
+        unique_lock<mutex> lock(m_lock);
+        return m_peers.size();
+    }
+
+} /* namespace isotpp */
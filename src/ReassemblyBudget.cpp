@@ -0,0 +1,108 @@
+/**
+ * @file ReassemblyBudget.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the reassembly memory budget.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+// stl
+#include <algorithm>
+#include <utility>
+
+#include "ReassemblyBudget.hpp"
+
+namespace isotpp {
+
+    using std::unique_lock;
+
+    ReassemblyBudget::ReassemblyBudget(const size_t globalLimit, const size_t sessionLimit, const uint8_t maxWaits, const size_t maxWaitingSessions):
+    m_statistics({}), m_globalLimit(globalLimit), m_maxWaitingSessions(maxWaitingSessions), m_sessionLimit(sessionLimit), m_decisions(0), m_maxWaits(maxWaits) {}
+
+    /**
+     * @brief Decides whether the message announced by a first frame may be reassembled.
+     *
+     * @param sessionKey The key identifying the receiving session, usually the ID the first frame was received with.
+     * @param declaredLength The message length declared in the first frame.
+     *
+     * @return FlowControlFlag::CONTINUE if the memory was reserved.
+     * @return FlowControlFlag::WAIT if the message does not fit right now; call again later with the same length.
+     * @return FlowControlFlag::ABORT_TRANSMISSION if the message must be rejected with FC OVERFLOW.
+     */
+    FlowControlFlag ReassemblyBudget::admit(const uint64_t sessionKey, const uint32_t declaredLength) {
+        unique_lock<mutex> lock(m_lock);
+
+        releaseLocked(sessionKey); // a new first frame replaces the message being received
+        m_decisions++;
+
+        if (declaredLength > m_sessionLimit || declaredLength > m_globalLimit) {
+            m_waitingSessions.erase(sessionKey);
+            m_statistics.rejected++;
+            return FlowControlFlag::ABORT_TRANSMISSION;
+        }
+
+        if (m_statistics.bytesInUse + declaredLength <= m_globalLimit) {
+            m_waitingSessions.erase(sessionKey);
+            m_reservations[sessionKey] = declaredLength;
+            m_statistics.admitted++;
+            m_statistics.bytesInUse += declaredLength;
+            m_statistics.peakBytesInUse = std::max(m_statistics.peakBytesInUse, m_statistics.bytesInUse);
+            return FlowControlFlag::CONTINUE;
+        }
+
+        auto waiting = m_waitingSessions.find(sessionKey);
+        if (waiting == m_waitingSessions.end()) {
+            if (m_maxWaitingSessions == 0) {
+                m_statistics.rejected++;
+                return FlowControlFlag::ABORT_TRANSMISSION;
+            }
+
+            if (m_waitingSessions.size() >= m_maxWaitingSessions) {
+                auto oldest = m_waitingSessions.begin();
+                for (auto it = m_waitingSessions.begin(); it != m_waitingSessions.end(); it++) {
+                    if (it->second.lastWait < oldest->second.lastWait) { oldest = it; }
+                }
+                m_waitingSessions.erase(oldest);
+                m_statistics.forgotten++;
+            }
+
+            waiting = m_waitingSessions.insert(std::make_pair(sessionKey, WaitingSession{ 0, 0 })).first;
+        } else if (waiting->second.waits >= m_maxWaits) {
+            m_waitingSessions.erase(waiting);
+            m_statistics.rejected++;
+            return FlowControlFlag::ABORT_TRANSMISSION;
+        }
+
+        waiting->second.waits++;
+        waiting->second.lastWait = m_decisions;
+        m_statistics.waited++;
+        return FlowControlFlag::WAIT;
+    }
+
+    /**
+     * @brief Releases the memory reserved by a session, e.g. once its message was completed or aborted.
+     *
+     * @remarks Also forgets the amount of waits of a session which gave up waiting.
+     */
+    void ReassemblyBudget::release(const uint64_t sessionKey) {
+        unique_lock<mutex> lock(m_lock);
+
+        releaseLocked(sessionKey);
+        m_waitingSessions.erase(sessionKey);
+    }
+
+    ReassemblyBudgetStatistics ReassemblyBudget::getStatistics() {
+        unique_lock<mutex> lock(m_lock);
+        return m_statistics;
+    }
+
+    void ReassemblyBudget::releaseLocked(const uint64_t key) {
+        const auto reservation = m_reservations.find(key);
+        if (reservation == m_reservations.end()) { return; }
+
+        m_statistics.bytesInUse -= reservation->second;
+        m_reservations.erase(reservation);
+    }
+
+} /* namespace isotpp */
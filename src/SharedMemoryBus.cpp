@@ -0,0 +1,466 @@
+/**
+ * @file SharedMemoryBus.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the shared-memory transport.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+// stl
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+
+// libc
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "SharedMemoryBus.hpp"
+
+namespace isotpp {
+
+    using std::atomic;
+    using std::memcpy;
+    using std::memory_order_acquire;
+    using std::memory_order_relaxed;
+    using std::memory_order_release;
+    using std::unique_lock;
+
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "The shared-memory transport requires lock-free 64-bit atomics");
+
+    static const uint32_t   SHARED_BUS_MAGIC = 0x50544f53; //!< "SOTP"
+    static const uint32_t   SHARED_BUS_VERSION = 1;
+
+    /**
+     * @brief A frame as stored in shared memory. Large enough for CAN FD.
+     */
+    struct SharedFrame {
+        uint32_t            canId;
+        uint8_t             length;
+        uint8_t             reserved[3];
+        uint8_t             data[CANFD_MAX_DLEN];
+    };
+
+    /**
+     * @brief A slot of the receive ring.
+     *
+     * The sequence is odd while the owner writes frame n into the slot (2n + 1) and even once it is complete (2n + 2).
+     */
+    struct alignas(64) RxSlot {
+        atomic<uint64_t>    sequence;
+        SharedFrame         frame;
+    };
+
+    /**
+     * @brief A cell of the transmit queue (bounded multi-producer queue).
+     *
+     * A cell at position n may be written once its sequence equals n and read once it equals n + 1.
+     */
+    struct alignas(64) TxCell {
+        atomic<uint64_t>    sequence;
+        SharedFrame         frame;
+    };
+
+    /**
+     * @brief The header at the start of the shared region, followed by the receive ring and the transmit queue.
+     */
+    struct SharedBusHeader {
+        atomic<uint32_t>    magic; //!< Written last by the owner; clients refuse to attach to regions without it
+        uint32_t            version;
+        uint32_t            rxCapacity;
+        uint32_t            txCapacity;
+
+        alignas(64) atomic<uint64_t> rxWriteIndex; //!< The index of the next frame the owner publishes
+        alignas(64) atomic<uint64_t> txEnqueueIndex;
+        alignas(64) atomic<uint64_t> txDequeueIndex;
+    };
+
+    /**
+     * @brief Owns a mapping of the shared region and knows where its parts are.
+     */
+    class SharedMemoryMapping {
+        public:
+            SharedMemoryMapping(void* base, const size_t size): base(static_cast<uint8_t*>(base)), size(size) {}
+            ~SharedMemoryMapping() { munmap(base, size); }
+
+            static size_t   getRegionSize(const size_t rxCapacity, const size_t txCapacity) {
+                return sizeof(SharedBusHeader) + rxCapacity * sizeof(RxSlot) + txCapacity * sizeof(TxCell);
+            }
+
+            SharedBusHeader* getHeader() const { return reinterpret_cast<SharedBusHeader*>(base); }
+            RxSlot*         getRxSlots() const { return reinterpret_cast<RxSlot*>(base + sizeof(SharedBusHeader)); }
+            TxCell*         getTxCells() const { return reinterpret_cast<TxCell*>(base + sizeof(SharedBusHeader) + getHeader()->rxCapacity * sizeof(RxSlot)); }
+
+            uint8_t*        base;
+            size_t          size;
+    };
+
+    /**
+     * @brief Rounds up to the next power of two, so ring positions can be masked.
+     */
+    static size_t toPowerOfTwo(const size_t x) {
+        size_t result = 1;
+        while (result < x) { result <<= 1; }
+        return result;
+    }
+
+    /**
+     * @brief Constructs the header, ring and queue in a freshly mapped region and marks it as ready.
+     */
+    static void initialiseRegion(const shared_ptr<SharedMemoryMapping>& mapping, const size_t rxCapacity, const size_t txCapacity) {
+        SharedBusHeader* header = new (mapping->base) SharedBusHeader();
+        header->version = SHARED_BUS_VERSION;
+        header->rxCapacity = rxCapacity;
+        header->txCapacity = txCapacity;
+        header->rxWriteIndex.store(0, memory_order_relaxed);
+        header->txEnqueueIndex.store(0, memory_order_relaxed);
+        header->txDequeueIndex.store(0, memory_order_relaxed);
+
+        RxSlot* rxSlots = mapping->getRxSlots();
+        for (size_t i = 0; i < rxCapacity; i++) { new (&rxSlots[i]) RxSlot(); rxSlots[i].sequence.store(0, memory_order_relaxed); }
+
+        TxCell* txCells = mapping->getTxCells();
+        for (size_t i = 0; i < txCapacity; i++) { new (&txCells[i]) TxCell(); txCells[i].sequence.store(i, memory_order_relaxed); }
+
+        header->magic.store(SHARED_BUS_MAGIC, memory_order_release);
+    }
+
+    #pragma region "Owner"
+    SharedMemoryBusOwner::SharedMemoryBusOwner(const size_t rxCapacity, const size_t txCapacity): m_sendFailures(0),
+    m_rxCapacity(toPowerOfTwo(std::max<size_t>(rxCapacity, 1))), m_txCapacity(toPowerOfTwo(std::max<size_t>(txCapacity, 1))), m_device(0), m_inode(0) {}
+
+    SharedMemoryBusOwner::~SharedMemoryBusOwner() {
+        if (m_name.empty()) { return; }
+
+        // only unlink the name if it still refers to this owner's region, and not to one which replaced it
+        struct stat info{};
+        const int fd = shm_open(m_name.c_str(), O_RDONLY, 0);
+        if (fd < 0) { return; }
+
+        if (fstat(fd, &info) == 0 && info.st_dev == m_device && info.st_ino == m_inode) { shm_unlink(m_name.c_str()); }
+        close(fd);
+    }
+
+    /**
+     * @brief Creates a named shared-memory region which clients in other processes can attach to.
+     *
+     * @remarks An existing region is never truncated, as a live owner and its clients may still have it mapped.
+     * A stale region left behind by a crashed owner is only replaced if replaceExisting is set: it is unlinked and
+     * a new one is created, while processes still mapping the old region keep it until they unmap it.
+     *
+     * @param name The region's name, e.g. "/isotpp-can0".
+     * @param replaceExisting Whether to unlink a region which already exists under the name.
+     *
+     * @return ReturnValue::SUCCESS if the region is ready.
+     * @return ReturnValue::IN_PROGRESS if this owner already created a region.
+     * @return ReturnValue::ERROR if the region could not be created or mapped; check errno. EEXIST if the name is in use.
+     */
+    ReturnValue SharedMemoryBusOwner::create(const string& name, const bool replaceExisting) {
+        unique_lock<mutex> lock(m_lock);
+        if (m_mapping) { return ReturnValue::IN_PROGRESS; }
+
+        const size_t size = SharedMemoryMapping::getRegionSize(m_rxCapacity, m_txCapacity);
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+
+        if (fd < 0 && errno == EEXIST && replaceExisting) {
+            if (shm_unlink(name.c_str()) != 0 && errno != ENOENT) { return ReturnValue::ERROR; }
+            fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+        }
+        if (fd < 0) { return ReturnValue::ERROR; }
+
+        struct stat info{};
+        if (ftruncate(fd, size) != 0 || fstat(fd, &info) != 0) {
+            const int error = errno;
+            close(fd);
+            shm_unlink(name.c_str());
+            errno = error;
+            return ReturnValue::ERROR;
+        }
+
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int error = errno;
+        close(fd);
+
+        if (base == MAP_FAILED) {
+            shm_unlink(name.c_str());
+            errno = error;
+            return ReturnValue::ERROR;
+        }
+
+        m_mapping = shared_ptr<SharedMemoryMapping>(new SharedMemoryMapping(base, size));
+        m_name = name;
+        m_device = info.st_dev;
+        m_inode = info.st_ino;
+        initialiseRegion(m_mapping, m_rxCapacity, m_txCapacity);
+
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Creates an anonymous region, which can only be attached to from within this process.
+     *
+     * @return ReturnValue::SUCCESS if the region is ready.
+     * @return ReturnValue::IN_PROGRESS if this owner already created a region.
+     * @return ReturnValue::ERROR if the region could not be mapped; check errno.
+     */
+    ReturnValue SharedMemoryBusOwner::createInProcess() {
+        unique_lock<mutex> lock(m_lock);
+        if (m_mapping) { return ReturnValue::IN_PROGRESS; }
+
+        const size_t size = SharedMemoryMapping::getRegionSize(m_rxCapacity, m_txCapacity);
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) { return ReturnValue::ERROR; }
+
+        m_mapping = shared_ptr<SharedMemoryMapping>(new SharedMemoryMapping(base, size));
+        initialiseRegion(m_mapping, m_rxCapacity, m_txCapacity);
+
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Publishes a frame received from the bus to all clients.
+     *
+     * @remarks Never blocks; clients which fall behind lose the oldest frames.
+     *
+     * @return ReturnValue::SUCCESS if the frame was published.
+     * @return ReturnValue::INVALID_LENGTH if the frame is longer than a CAN FD frame.
+     * @return ReturnValue::ERROR if no region was created.
+     */
+    ReturnValue SharedMemoryBusOwner::publish(const CanId& canId, const uint8_t* data, const uint8_t length) {
+        if (length > CANFD_MAX_DLEN) { return ReturnValue::INVALID_LENGTH; }
+
+        unique_lock<mutex> lock(m_lock);
+        if (!m_mapping) { return ReturnValue::ERROR; }
+
+        SharedBusHeader* header = m_mapping->getHeader();
+        const uint64_t index = header->rxWriteIndex.load(memory_order_relaxed);
+        RxSlot& slot = m_mapping->getRxSlots()[index & (m_rxCapacity - 1)];
+
+        slot.sequence.store(2 * index + 1, memory_order_relaxed);
+        std::atomic_thread_fence(memory_order_release);
+
+        slot.frame.canId = static_cast<uint32_t>(canId);
+        slot.frame.length = length;
+        memcpy(slot.frame.data, data, length);
+
+        slot.sequence.store(2 * index + 2, memory_order_release);
+        header->rxWriteIndex.store(index + 1, memory_order_release);
+
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Hands frames queued by clients to the socket.
+     *
+     * @remarks A frame is only taken from the queue once the callback accepted it. If the callback fails (e.g. ENOBUFS or
+     * bus-off), draining stops and the frame is handed over again by the next call.
+     *
+     * @param sendCallback Writes a frame to the socket.
+     * @param maxFrames The max. amount of frames to hand over.
+     *
+     * @return size_t The amount of frames sent and taken from the queue.
+     */
+    size_t SharedMemoryBusOwner::drainTransmitQueue(const sendcancb_t& sendCallback, const size_t maxFrames) {
+        unique_lock<mutex> lock(m_lock);
+        if (!m_mapping) { return 0; }
+
+        SharedBusHeader* header = m_mapping->getHeader();
+        TxCell* cells = m_mapping->getTxCells();
+        size_t drained = 0;
+
+        while (drained < maxFrames) {
+            const uint64_t position = header->txDequeueIndex.load(memory_order_relaxed);
+            TxCell& cell = cells[position & (m_txCapacity - 1)];
+
+            if (cell.sequence.load(memory_order_acquire) != position + 1) { break; }
+
+            const buf_t frame(cell.frame.data, cell.frame.data + cell.frame.length);
+
+            if (!sendCallback(CanId(cell.frame.canId), frame)) {
+                m_sendFailures++;
+                break;
+            }
+
+            cell.sequence.store(position + m_txCapacity, memory_order_release);
+            header->txDequeueIndex.store(position + 1, memory_order_relaxed);
+            drained++;
+        }
+
+        return drained;
+    }
+    #pragma endregion
+
+    #pragma region "Client"
+    SharedMemoryBusClient::SharedMemoryBusClient(): m_lostFrames(0), m_readIndex(0) {}
+
+    /**
+     * @brief Attaches to a named region created by an owner in another process.
+     *
+     * @remarks Only frames published after attaching are received.
+     *
+     * @return ReturnValue::SUCCESS if attached.
+     * @return ReturnValue::IN_PROGRESS if already attached.
+     * @return ReturnValue::ERROR if the region could not be opened or is not (yet) a valid region; check errno.
+     */
+    ReturnValue SharedMemoryBusClient::attach(const string& name) {
+        const int fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) { return ReturnValue::ERROR; }
+
+        struct stat info{};
+        if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SharedBusHeader)) {
+            close(fd);
+            errno = EINVAL;
+            return ReturnValue::ERROR;
+        }
+
+        void* base = mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int error = errno;
+        close(fd);
+
+        if (base == MAP_FAILED) {
+            errno = error;
+            return ReturnValue::ERROR;
+        }
+
+        const shared_ptr<SharedMemoryMapping> mapping(new SharedMemoryMapping(base, info.st_size));
+        const SharedBusHeader* header = mapping->getHeader();
+
+        if (header->magic.load(memory_order_acquire) != SHARED_BUS_MAGIC || header->version != SHARED_BUS_VERSION ||
+            SharedMemoryMapping::getRegionSize(header->rxCapacity, header->txCapacity) > mapping->size) {
+            errno = EINVAL;
+            return ReturnValue::ERROR;
+        }
+
+        return attachMapping(mapping);
+    }
+
+    /**
+     * @brief Attaches to an owner within the same process.
+     *
+     * @return ReturnValue::SUCCESS if attached.
+     * @return ReturnValue::IN_PROGRESS if already attached.
+     * @return ReturnValue::ERROR if the owner did not create a region yet.
+     */
+    ReturnValue SharedMemoryBusClient::attach(const SharedMemoryBusOwner& owner) {
+        if (!owner.m_mapping) { return ReturnValue::ERROR; }
+
+        return attachMapping(owner.m_mapping);
+    }
+
+    ReturnValue SharedMemoryBusClient::attachMapping(const shared_ptr<SharedMemoryMapping>& mapping) {
+        unique_lock<mutex> lock(m_lock);
+        if (m_mapping) { return ReturnValue::IN_PROGRESS; }
+
+        m_mapping = mapping;
+        m_readIndex = mapping->getHeader()->rxWriteIndex.load(memory_order_acquire);
+        m_lostFrames = 0;
+
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Reads the frames published since the last call.
+     *
+     * Each slot is read under its sequence number: a slot which the owner overwrote while it was being read is
+     * counted as lost instead of being passed on torn.
+     *
+     * @param callback Receives each new frame which passes the acceptance filter.
+     * @param maxFrames The max. amount of frames to pass to the callback.
+     *
+     * @return size_t The amount of frames passed to the callback.
+     */
+    size_t SharedMemoryBusClient::receive(const rxframecb_t& callback, const size_t maxFrames) {
+        unique_lock<mutex> lock(m_lock);
+        if (!m_mapping) { return 0; }
+
+        const SharedBusHeader* header = m_mapping->getHeader();
+        const RxSlot* slots = m_mapping->getRxSlots();
+        const uint64_t capacity = header->rxCapacity;
+        const uint64_t writeIndex = header->rxWriteIndex.load(memory_order_acquire);
+        size_t received = 0;
+
+        if (writeIndex < m_readIndex) {
+            m_readIndex = writeIndex; // the region was recreated under this client
+        } else if (writeIndex - m_readIndex > capacity) {
+            m_lostFrames += writeIndex - capacity - m_readIndex;
+            m_readIndex = writeIndex - capacity;
+        }
+
+        for (; m_readIndex < writeIndex && received < maxFrames; m_readIndex++) {
+            const RxSlot& slot = slots[m_readIndex & (capacity - 1)];
+            const uint64_t expected = 2 * m_readIndex + 2;
+
+            if (slot.sequence.load(memory_order_acquire) != expected) {
+                m_lostFrames++;
+                continue;
+            }
+
+            // only the ID is read for frames the filter rejects
+            if (m_acceptanceFilter && !m_acceptanceFilter->accepts(slot.frame.canId)) { continue; }
+
+            SharedFrame frame;
+            memcpy(&frame, &slot.frame, sizeof(frame));
+            std::atomic_thread_fence(memory_order_acquire);
+
+            if (slot.sequence.load(memory_order_relaxed) != expected || frame.length > CANFD_MAX_DLEN) {
+                m_lostFrames++;
+                continue;
+            }
+
+            callback(CanId(frame.canId), frame.data, frame.length);
+            received++;
+        }
+
+        return received;
+    }
+
+    /**
+     * @brief Queues a frame for the owner to send.
+     *
+     * @return true If the frame was queued.
+     * @return false If the client is not attached, the frame is too long or the transmit queue is full.
+     */
+    bool SharedMemoryBusClient::send(const CanId& canId, const buf_t& frame) {
+        if (frame.size() > CANFD_MAX_DLEN) { return false; }
+
+        shared_ptr<SharedMemoryMapping> mapping{};
+        {
+            unique_lock<mutex> lock(m_lock);
+            mapping = m_mapping;
+        }
+        if (!mapping) { return false; }
+
+        SharedBusHeader* header = mapping->getHeader();
+        TxCell* cells = mapping->getTxCells();
+        const uint64_t capacity = header->txCapacity;
+        uint64_t position = header->txEnqueueIndex.load(memory_order_relaxed);
+        TxCell* cell = nullptr;
+
+        while (true) {
+            cell = &cells[position & (capacity - 1)];
+            const int64_t difference = static_cast<int64_t>(cell->sequence.load(memory_order_acquire) - position);
+
+            if (difference == 0) {
+                if (header->txEnqueueIndex.compare_exchange_weak(position, position + 1, memory_order_relaxed)) { break; }
+            } else if (difference < 0) {
+                return false; // full
+            } else {
+                position = header->txEnqueueIndex.load(memory_order_relaxed);
+            }
+        }
+
+        cell->frame.canId = static_cast<uint32_t>(canId);
+        cell->frame.length = frame.size();
+        memcpy(cell->frame.data, frame.data(), frame.size());
+        cell->sequence.store(position + 1, memory_order_release);
+
+        return true;
+    }
+    #pragma endregion
+
+} /* namespace isotpp */
@@ -0,0 +1,17 @@
+/**
+ * @file StaticIsoTp.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the instantiation of the statically sized ISOTP engine configured by the build.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include "StaticIsoTp.hpp"
+
+namespace isotpp {
+
+    template class StaticIsoTp<isotpp_EMBEDDED_MAX_SESSIONS, isotpp_EMBEDDED_MAX_MESSAGE_SIZE>;
+
+} /* namespace isotpp */
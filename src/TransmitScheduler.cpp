@@ -0,0 +1,357 @@
+/**
+ * @file TransmitScheduler.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the transmit scheduler.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+// stl
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "Tracepoints.hpp"
+#include "TransmitScheduler.hpp"
+#include "types/Helpers.hpp"
+
+namespace isotpp {
+
+    using std::memcpy;
+    using std::unique_lock;
+
+    using types::FrameType;
+    using types::frames::ConsecutiveFrame_Struct;
+    using types::frames::FirstFrame_Struct;
+    using types::frames::SingleFrame_Struct;
+
+    /**
+     * @brief Orders CAN IDs the way bus arbitration does.
+     *
+     * Arbitration compares the 11-bit base ID first; on a tie, a standard frame's dominant RTR bit beats the recessive
+     * SRR bit of an extended frame, and extended frames are then decided by their 18-bit ID extension.
+     */
+    static uint32_t getArbitrationKey(const CanId& canId) {
+        const uint32_t id = static_cast<uint32_t>(canId);
+
+        if (!canId.isExtendedFrame()) { return (id & CAN_SFF_MASK) << 19; }
+
+        return (((id & CAN_EFF_MASK) >> 18) << 19) | (1u << 18) | (id & 0x3ffff);
+    }
+
+    TransmitScheduler::TransmitScheduler(const size_t maxQueueDepth): m_flowControlTimeout(1000), m_maxQueueDepth(maxQueueDepth) {}
+
+    size_t TransmitScheduler::getPendingMessages() {
+        unique_lock<mutex> lock(m_lock);
+        size_t pending = 0;
+
+        for (const auto& peer : m_peers) { pending += peer.second.messages.size(); }
+
+        return pending;
+    }
+
+    /**
+     * @brief Queues a message for transmission to a peer.
+     *
+     * @param data The payload to send. Must be 1 - 4095 bytes long.
+     * @param txId The CAN ID to send the message with.
+     * @param priority The user priority; lower values are sent first. Ties are broken by the CAN ID.
+     *
+     * @return ReturnValue::SUCCESS if the message was queued.
+     * @return ReturnValue::INVALID_LENGTH if the message is empty.
+     * @return ReturnValue::OVERFLOW if the message is too large for ISO-TP.
+     * @return ReturnValue::BUFFER_FULL if the peer's queue is full.
+     */
+    ReturnValue TransmitScheduler::enqueue(const buf_t& data, const CanId& txId, const uint8_t priority) {
+        if (data.empty()) { return ReturnValue::INVALID_LENGTH; }
+        if (data.size() > types::ISOTP_MAX_MESSAGE_LENGTH) { return ReturnValue::OVERFLOW; }
+
+        unique_lock<mutex> lock(m_lock);
+        const uint32_t key = static_cast<uint32_t>(txId);
+        auto peer = m_peers.find(key);
+
+        if (peer == m_peers.end()) {
+            peer = m_peers.insert(std::make_pair(key, PeerQueue(txId))).first;
+        }
+
+        if (peer->second.messages.size() >= m_maxQueueDepth) { return ReturnValue::BUFFER_FULL; }
+
+        peer->second.messages.push_back({ data, priority });
+
+        return ReturnValue::SUCCESS;
+    }
+
+    /**
+     * @brief Passes a flow-control frame received from a peer to the message currently being sent to it.
+     *
+     * @param txId The CAN ID of the message the FC responds to.
+     * @param flag The flow-control flag.
+     * @param blockSize The block size granted by the peer.
+     * @param separationTime The raw STmin byte requested by the peer.
+     *
+     * @return ReturnValue::SUCCESS if the FC was applied.
+     * @return ReturnValue::UNEXPECTED_FRAME if no message to txId is waiting for FC.
+     */
+    ReturnValue TransmitScheduler::handleFlowControlFrame(const CanId& txId, const FlowControlFlag flag, const uint8_t blockSize, const uint8_t separationTime) {
+        deque<completion_t> completions{};
+        ReturnValue returnVal = ReturnValue::SUCCESS;
+
+        {
+            unique_lock<mutex> lock(m_lock);
+            const auto peer = m_peers.find(static_cast<uint32_t>(txId));
+
+            if (peer == m_peers.end() || peer->second.state != TransmitState::WAIT_FLOW_CONTROL) {
+                return ReturnValue::UNEXPECTED_FRAME;
+            }
+
+            auto& queue = peer->second;
+            const uint64_t now = getTick();
+
+            ISOTPP_TRACE5(fc_receive, peer->first, static_cast<uint8_t>(flag), blockSize, separationTime, now - queue.flowControlRequested);
+
+            switch (flag) {
+                case FlowControlFlag::CONTINUE:
+                    if (m_peerParameterCache) {
+                        m_peerParameterCache->recordFlowControl(txId, blockSize, separationTime, static_cast<uint32_t>(now - queue.flowControlRequested), now);
+                    }
+
+                    queue.state = TransmitState::SENDING;
+                    queue.blockSize = blockSize;
+                    queue.framesLeftInBlock = blockSize;
+                    queue.separationTimeMicros = types::separationTimeToMicros(separationTime);
+                    queue.nextFrameTick = now; // STmin only applies between consecutive frames
+                    break;
+                case FlowControlFlag::WAIT:
+                    queue.flowControlDeadline = now + m_flowControlTimeout.count();
+                    queue.flowControlRequested = now;
+                    break;
+                case FlowControlFlag::ABORT_TRANSMISSION:
+                default:
+                    finishMessage(queue, ReturnValue::OVERFLOW, now, completions);
+                    returnVal = ReturnValue::OVERFLOW;
+                    break;
+            }
+        }
+
+        notify(completions);
+        return returnVal;
+    }
+
+    /**
+     * @brief Sends all frames which are currently due.
+     *
+     * On each iteration the ready peer with the lowest (priority, CAN ID) pair gets to send exactly one frame,
+     * after which the ready set is re-evaluated. This interleaves messages to different peers and lets
+     * urgent messages overtake bulk transfers at frame granularity.
+     *
+     * @return size_t The amount of frames sent.
+     */
+    size_t TransmitScheduler::poll() {
+        deque<completion_t> completions{};
+        size_t framesSent = 0;
+
+        {
+            unique_lock<mutex> lock(m_lock);
+
+            while (true) {
+                const uint64_t now = getTick();
+                PeerQueue* next = nullptr;
+
+                for (auto& peer : m_peers) {
+                    if (!isReady(peer.second, now, completions)) { continue; }
+
+                    if (next == nullptr ||
+                        peer.second.messages.front().priority < next->messages.front().priority ||
+                        (peer.second.messages.front().priority == next->messages.front().priority && getArbitrationKey(peer.second.txId) < getArbitrationKey(next->txId))) {
+                        next = &peer.second;
+                    }
+                }
+
+                if (next == nullptr) { break; }
+
+                const CanId txId = next->txId;
+                const uint8_t frameLength = static_cast<uint8_t>(getNextFrameLength(*next));
+                if (m_rateLimiter && !m_rateLimiter->tryAcquire(txId, frameLength)) { break; }
+
+                const bool sent = sendNextFrame(*next, now, completions);
+                if (m_rateLimiter) { m_rateLimiter->commit(txId, frameLength, sent); }
+                framesSent++;
+            }
+        }
+
+        notify(completions);
+        return framesSent;
+    }
+
+    /**
+     * @brief Determines whether a peer may send its next frame.
+     *
+     * @remarks Also fails the head message if the peer did not send FC in time (N_Bs).
+     */
+    bool TransmitScheduler::isReady(PeerQueue& peer, const uint64_t now, deque<completion_t>& completions) {
+        if (peer.messages.empty()) { return false; }
+
+        switch (peer.state) {
+            case TransmitState::IDLE:
+                return true;
+            case TransmitState::SENDING:
+                return now >= peer.nextFrameTick;
+            case TransmitState::WAIT_FLOW_CONTROL:
+            default:
+                if (now >= peer.flowControlDeadline) {
+                    ISOTPP_TRACE2(timeout, static_cast<uint32_t>(peer.txId), ISOTPP_TIMEOUT_N_BS);
+                    finishMessage(peer, ReturnValue::TIMEOUT_OCCURRED, now, completions);
+                    return !peer.messages.empty();
+                }
+                return false;
+        }
+    }
+
+    /**
+     * @brief Gets the length of the next frame the peer will send.
+     */
+    size_t TransmitScheduler::getNextFrameLength(const PeerQueue& peer) const {
+        const size_t messageLength = peer.messages.front().data.size();
+
+        if (peer.state == TransmitState::IDLE) {
+            return messageLength <= types::SINGLE_FRAME_MAX_DATA ? messageLength + 1 : CAN_MAX_DLEN;
+        }
+
+        return std::min<size_t>(messageLength - peer.offset, types::CONSECUTIVE_FRAME_MAX_DATA) + 1;
+    }
+
+    /**
+     * @brief Builds the CF carrying the message's data from offset on.
+     */
+    buf_t TransmitScheduler::buildConsecutiveFrame(const buf_t& data, const size_t offset, const uint8_t sequenceNumber) const {
+        const size_t length = std::min<size_t>(data.size() - offset, types::CONSECUTIVE_FRAME_MAX_DATA);
+        ConsecutiveFrame_Struct raw = {};
+        raw.frameType = FrameType::CONSECUTIVE_FRAME;
+        raw.frameIndex = sequenceNumber;
+        memcpy(raw.frameData, data.data() + offset, length);
+
+        return types::frameStructToVector(raw, length + 1);
+    }
+
+    /**
+     * @brief Segments the first block of a message whose FF was just sent, if the peer's parameters are cached.
+     *
+     * The block's pacing is planned from the cached BS and STmin; both are overwritten once the actual FC arrives.
+     * As a CF only depends on its offset and sequence number, prepared frames stay valid even if the peer grants a
+     * different BS; any frames beyond the actual block are simply sent in the next block.
+     */
+    void TransmitScheduler::prepareFirstBlock(PeerQueue& peer, const uint64_t now) {
+        PeerParameters parameters{};
+        if (!m_peerParameterCache || !m_peerParameterCache->lookup(peer.txId, now, parameters)) { return; }
+
+        const buf_t& data = peer.messages.front().data;
+        const size_t frames = (parameters.blockSize == 0 || parameters.blockSize > MAX_PREPARED_FRAMES) ? MAX_PREPARED_FRAMES : parameters.blockSize;
+        size_t offset = peer.offset;
+        uint8_t sequenceNumber = peer.sequenceNumber;
+
+        peer.blockSize = parameters.blockSize;
+        peer.framesLeftInBlock = parameters.blockSize;
+        peer.separationTimeMicros = parameters.separationTimeMicros;
+
+        for (size_t i = 0; i < frames && offset < data.size(); i++) {
+            peer.preparedFrames.push_back(buildConsecutiveFrame(data, offset, sequenceNumber));
+            offset += std::min<size_t>(data.size() - offset, types::CONSECUTIVE_FRAME_MAX_DATA);
+            sequenceNumber = (sequenceNumber + 1) & 0x0f;
+        }
+    }
+
+    /**
+     * @brief Sends the next frame of the peer's head message and advances its state.
+     *
+     * @return false If the send callback rejected the frame; the head message has been failed.
+     */
+    bool TransmitScheduler::sendNextFrame(PeerQueue& peer, const uint64_t now, deque<completion_t>& completions) {
+        const buf_t& data = peer.messages.front().data;
+        buf_t frame{};
+
+        if (peer.state == TransmitState::IDLE) { peer.messageStarted = now; }
+
+        if (peer.state == TransmitState::IDLE && data.size() <= types::SINGLE_FRAME_MAX_DATA) {
+            SingleFrame_Struct raw = {};
+            raw.frameType = FrameType::SINGLE_FRAME;
+            raw.dataLength = data.size();
+            memcpy(raw.frameData, data.data(), data.size());
+            frame = types::frameStructToVector(raw, data.size() + 1);
+        } else if (peer.state == TransmitState::IDLE) {
+            FirstFrame_Struct raw = {};
+            raw.frameType = FrameType::FIRST_FRAME;
+            raw.dataLengthHigh = (data.size() >> 8) & 0x0f;
+            raw.dataLengthLow = data.size() & 0xff;
+            memcpy(raw.frameData, data.data(), types::FIRST_FRAME_DATA);
+            frame = types::frameStructToVector(raw, sizeof(raw));
+        } else if (!peer.preparedFrames.empty()) {
+            frame.swap(peer.preparedFrames.front());
+            peer.preparedFrames.pop_front();
+        } else {
+            frame = buildConsecutiveFrame(data, peer.offset, peer.sequenceNumber);
+        }
+
+        if (!m_sendCanCallback || !m_sendCanCallback(peer.txId, frame)) {
+            finishMessage(peer, ReturnValue::ERROR, now, completions);
+            return false;
+        }
+
+        ISOTPP_TRACE4(frame_send, static_cast<uint32_t>(peer.txId), static_cast<uint8_t>(frame[0] >> 4), static_cast<uint8_t>(frame[0] & 0x0f), peer.offset);
+
+        if (peer.state == TransmitState::IDLE && data.size() <= types::SINGLE_FRAME_MAX_DATA) {
+            finishMessage(peer, ReturnValue::SUCCESS, now, completions);
+        } else if (peer.state == TransmitState::IDLE) {
+            peer.offset = types::FIRST_FRAME_DATA;
+            peer.sequenceNumber = 1;
+            peer.state = TransmitState::WAIT_FLOW_CONTROL;
+            peer.flowControlDeadline = now + m_flowControlTimeout.count();
+            peer.flowControlRequested = now;
+            prepareFirstBlock(peer, now);
+        } else {
+            peer.offset += std::min<size_t>(data.size() - peer.offset, types::CONSECUTIVE_FRAME_MAX_DATA);
+            peer.sequenceNumber = (peer.sequenceNumber + 1) & 0x0f;
+
+            if (peer.offset >= data.size()) {
+                finishMessage(peer, ReturnValue::SUCCESS, now, completions);
+            } else if (peer.blockSize != 0 && --peer.framesLeftInBlock == 0) {
+                peer.state = TransmitState::WAIT_FLOW_CONTROL;
+                peer.flowControlDeadline = now + m_flowControlTimeout.count();
+                peer.flowControlRequested = now;
+            } else {
+                // round sub-tick separation times up, the peer must never receive frames faster than requested
+                peer.nextFrameTick = now + (peer.separationTimeMicros + 999) / 1000;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Removes the head message of a peer's queue and resets the peer for the next message.
+     */
+    void TransmitScheduler::finishMessage(PeerQueue& peer, const ReturnValue result, const uint64_t now, deque<completion_t>& completions) {
+        ISOTPP_TRACE4(message_complete, static_cast<uint32_t>(peer.txId), peer.messages.front().data.size(), static_cast<int32_t>(result), now - peer.messageStarted);
+
+        peer.messages.pop_front();
+        peer.state = TransmitState::IDLE;
+        peer.offset = 0;
+        peer.sequenceNumber = 0;
+        peer.framesLeftInBlock = 0;
+        peer.preparedFrames.clear();
+
+        completions.push_back(std::make_pair(peer.txId, result));
+    }
+
+    /**
+     * @brief Invokes the completion callback for finished messages.
+     *
+     * @remarks Must be called without holding the lock, so the callback may queue further messages.
+     */
+    void TransmitScheduler::notify(deque<completion_t>& completions) {
+        if (!m_completionCallback) { return; }
+
+        for (const auto& completion : completions) { m_completionCallback(completion.first, completion.second); }
+    }
+
+} /* namespace isotpp */
@@ -0,0 +1,167 @@
+/**
+ * @file AcceptanceFilterTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Tests the standard and extended ID tables of the acceptance filter and its reference counting.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "AcceptanceFilter.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+namespace {
+
+    const uint32_t EXTENDED_ID = 0x18daf110 | CAN_EFF_FLAG;
+
+    void standardIds() {
+        AcceptanceFilter filter;
+
+        CHECK(!filter.accepts(0x7e0));
+        CHECK(filter.addId(CanId(0x7e0)) == ReturnValue::SUCCESS);
+        CHECK(filter.accepts(0x7e0));
+        CHECK(!filter.accepts(0x7e1));
+        CHECK(!filter.accepts(0x000));
+        CHECK(!filter.accepts(0x7ff));
+
+        // RTR and error frames never match
+        CHECK(!filter.accepts(0x7e0 | CAN_RTR_FLAG));
+        CHECK(!filter.accepts(0x7e0 | CAN_ERR_FLAG));
+
+        // the ends of the bitmap
+        filter.addId(CanId(0x000));
+        filter.addId(CanId(0x7ff));
+        CHECK(filter.accepts(0x000));
+        CHECK(filter.accepts(0x7ff));
+    }
+
+    void extendedIds() {
+        AcceptanceFilter filter;
+
+        CHECK(!filter.accepts(EXTENDED_ID));
+        CHECK(filter.addId(CanId(EXTENDED_ID)) == ReturnValue::SUCCESS);
+        CHECK(filter.accepts(EXTENDED_ID));
+        CHECK(filter.accepts(CanId(EXTENDED_ID)));
+        CHECK(!filter.accepts(EXTENDED_ID + 1));
+        CHECK(!filter.accepts(EXTENDED_ID | CAN_RTR_FLAG));
+
+        // the lower 11 bits of an extended ID are not a standard ID
+        CHECK(!filter.accepts(0x110));
+
+        filter.removeId(CanId(EXTENDED_ID));
+        CHECK(!filter.accepts(EXTENDED_ID));
+    }
+
+    void standardAndExtendedAreDistinct() {
+        AcceptanceFilter filter;
+        const uint32_t id = 0x123; // valid as both a standard and an extended ID
+
+        filter.addId(CanId(id));
+        CHECK(filter.accepts(id));
+        CHECK(!filter.accepts(id | CAN_EFF_FLAG));
+
+        filter.addId(CanId(id | CAN_EFF_FLAG));
+        CHECK(filter.accepts(id | CAN_EFF_FLAG));
+
+        // removing one format leaves the other
+        filter.removeId(CanId(id));
+        CHECK(!filter.accepts(id));
+        CHECK(filter.accepts(id | CAN_EFF_FLAG));
+
+        filter.addId(CanId(id));
+        filter.removeId(CanId(id | CAN_EFF_FLAG));
+        CHECK(filter.accepts(id));
+        CHECK(!filter.accepts(id | CAN_EFF_FLAG));
+    }
+
+    void referencesAreCounted() {
+        AcceptanceFilter filter;
+
+        for (const uint32_t id : { 0x7e8u, EXTENDED_ID }) {
+            filter.addId(CanId(id));
+            filter.addId(CanId(id));
+
+            filter.removeId(CanId(id));
+            CHECK(filter.accepts(id)); // still used by the other session
+
+            filter.removeId(CanId(id));
+            CHECK(!filter.accepts(id));
+
+            // removing an ID which is not in use is harmless, and does not count below zero
+            filter.removeId(CanId(id));
+            filter.addId(CanId(id));
+            CHECK(filter.accepts(id));
+        }
+    }
+
+    void extendedCapacity() {
+        AcceptanceFilter filter(2);
+
+        CHECK(filter.addId(CanId(EXTENDED_ID)) == ReturnValue::SUCCESS);
+        CHECK(filter.addId(CanId(EXTENDED_ID + 1)) == ReturnValue::SUCCESS);
+        CHECK(filter.addId(CanId(EXTENDED_ID + 2)) == ReturnValue::BUFFER_FULL);
+        CHECK(!filter.accepts(EXTENDED_ID + 2));
+
+        // further references to IDs already in the table, and standard IDs, still fit
+        CHECK(filter.addId(CanId(EXTENDED_ID)) == ReturnValue::SUCCESS);
+        CHECK(filter.addId(CanId(0x7e0)) == ReturnValue::SUCCESS);
+
+        filter.removeId(CanId(EXTENDED_ID + 1));
+        CHECK(filter.addId(CanId(EXTENDED_ID + 2)) == ReturnValue::SUCCESS);
+        CHECK(filter.accepts(EXTENDED_ID));
+        CHECK(filter.accepts(EXTENDED_ID + 2));
+    }
+
+    void removalKeepsColliders() {
+        AcceptanceFilter filter;
+
+        // a full table probes past colliding slots; removing IDs rebuilds it without losing the others
+        for (uint32_t i = 0; i < AcceptanceFilter::DEFAULT_MAX_EXTENDED_IDS; i++) {
+            CHECK(filter.addId(CanId((0x18da0000 + i * 0x100) | CAN_EFF_FLAG)) == ReturnValue::SUCCESS);
+        }
+        for (uint32_t i = 0; i < AcceptanceFilter::DEFAULT_MAX_EXTENDED_IDS; i += 2) {
+            filter.removeId(CanId((0x18da0000 + i * 0x100) | CAN_EFF_FLAG));
+        }
+        for (uint32_t i = 0; i < AcceptanceFilter::DEFAULT_MAX_EXTENDED_IDS; i++) {
+            CHECK(filter.accepts((0x18da0000 + i * 0x100) | CAN_EFF_FLAG) == (i % 2 == 1));
+        }
+    }
+
+    void clearRemovesEverything() {
+        AcceptanceFilter filter;
+
+        filter.addId(CanId(0x7e0));
+        filter.addId(CanId(EXTENDED_ID));
+        filter.clear();
+        CHECK(!filter.accepts(0x7e0));
+        CHECK(!filter.accepts(EXTENDED_ID));
+
+        CHECK(filter.addId(CanId(EXTENDED_ID)) == ReturnValue::SUCCESS);
+        CHECK(filter.accepts(EXTENDED_ID));
+    }
+
+}
+
+int main() {
+    standardIds();
+    extendedIds();
+    standardAndExtendedAreDistinct();
+    referencesAreCounted();
+    extendedCapacity();
+    removalKeepsColliders();
+    clearRemovesEverything();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,100 @@
+/**
+ * @file AdaptiveFlowControlTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Tests the flow-control parameters derived by the adaptive policy.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "AdaptiveFlowControl.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+namespace {
+
+    const CanId SESSION(0x7e8);
+
+    void blockSizeNeverExceedsFreeSpace() {
+        AdaptiveFlowControlConfig config;
+        config.minBlockSize = 8;
+        AdaptiveFlowControl policy(config);
+
+        // nothing measured yet: the configured minimum
+        FlowControlParameters parameters = policy.getParameters(SESSION);
+        CHECK(parameters.flag == FlowControlFlag::CONTINUE);
+        CHECK_EQUAL(8, parameters.blockSize);
+
+        // 12 bytes free hold a single CF, even though minBlockSize is larger
+        policy.recordBufferOccupancy(SESSION, 88, 100);
+        parameters = policy.getParameters(SESSION);
+        CHECK(parameters.flag == FlowControlFlag::CONTINUE);
+        CHECK_EQUAL(1, parameters.blockSize);
+
+        // not even a single CF fits
+        policy.recordBufferOccupancy(SESSION, 95, 100);
+        parameters = policy.getParameters(SESSION);
+        CHECK(parameters.flag == FlowControlFlag::WAIT);
+        CHECK_EQUAL(0, parameters.blockSize);
+
+        policy.recordBufferOccupancy(SESSION, 0, 100);
+        CHECK_EQUAL(8, policy.getParameters(SESSION).blockSize);
+    }
+
+    void increaseAdditivelyDecreaseMultiplicatively() {
+        AdaptiveFlowControlConfig config;
+        config.maxBlockSize = 4;
+        AdaptiveFlowControl policy(config);
+
+        CHECK_EQUAL(16, policy.getParameters(SESSION).separationTime); // a conservative 127ms / 8 to start with
+
+        for (int i = 0; i < 10; i++) { policy.recordBlockCompleted(SESSION); }
+        CHECK_EQUAL(4, policy.getParameters(SESSION).blockSize);
+        CHECK(policy.getParameters(SESSION).separationTime >= 0xf1); // below 1ms
+
+        policy.recordFrameLoss(SESSION);
+        CHECK_EQUAL(2, policy.getParameters(SESSION).blockSize);
+
+        // above the target occupancy, completed blocks do not speed the sender up
+        policy.recordBufferOccupancy(SESSION, 80, 100);
+        policy.recordBlockCompleted(SESSION);
+        CHECK_EQUAL(2, policy.getParameters(SESSION).blockSize);
+
+        // sessions are independent
+        CHECK_EQUAL(1, policy.getParameters(CanId(0x7e9)).blockSize);
+        policy.removeSession(SESSION);
+        CHECK_EQUAL(1, policy.getParameters(SESSION).blockSize);
+    }
+
+    void slowConsumerRaisesSeparation() {
+        AdaptiveFlowControl policy;
+
+        policy.recordBufferOccupancy(SESSION, 0, 100);
+        for (int i = 0; i < 30; i++) { policy.recordBlockCompleted(SESSION); }
+        CHECK(policy.getParameters(SESSION).separationTime >= 0xf1); // below 1ms
+
+        // 7 bytes per 10ms drained, while the buffer is above its target occupancy
+        policy.recordConsumed(SESSION, 7, 1000);
+        policy.recordConsumed(SESSION, 7, 11000);
+        policy.recordBufferOccupancy(SESSION, 80, 100);
+
+        const FlowControlParameters parameters = policy.getParameters(SESSION);
+        CHECK(parameters.flag == FlowControlFlag::CONTINUE);
+        CHECK_EQUAL(10, parameters.separationTime); // 10ms per CF
+        CHECK_EQUAL(2, parameters.blockSize); // 20 bytes free
+    }
+
+}
+
+int main() {
+    blockSizeNeverExceedsFreeSpace();
+    increaseAdditivelyDecreaseMultiplicatively();
+    slowConsumerRaisesSeparation();
+
+    return TEST_RESULT();
+}
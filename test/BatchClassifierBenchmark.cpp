@@ -0,0 +1,133 @@
+/**
+ * @file BatchClassifierBenchmark.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Measures the per-frame cost of the batch classifier's kernels against classifying frames one by one.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <chrono>
+#include <functional>
+#include <random>
+#include <vector>
+
+// libc
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "BatchClassifier.hpp"
+#include "types/Helpers.hpp"
+#include "types/Typedefs.hpp"
+
+/*
+ * Classifies the same 1000-frame batch over and over: mostly CF runs of a few interleaved sessions, with the odd SF,
+ * FF or FC and broken sequences in between. The per-frame baseline copies each frame into a buf_t and resolves its
+ * type, as the engines' per-frame ingest path does.
+ *
+ *  usage: batch_classifier_benchmark [batches=20000]
+ *
+ * Build with optimisations (-DCMAKE_BUILD_TYPE=Release) for meaningful numbers.
+ */
+
+using namespace isotpp;
+
+using std::chrono::steady_clock;
+using std::vector;
+
+namespace {
+
+    const size_t BATCH_FRAMES = 1000;
+
+    volatile uint32_t g_sink; //!< Keeps the compiler from dropping the measured work
+
+    vector<RawCanFrame> makeBatch() {
+        const uint32_t ids[] = { 0x7e0, 0x7e8, 0x18daf110 | CAN_EFF_FLAG };
+        std::minstd_rand random(42);
+        std::uniform_int_distribution<int> percent(0, 99);
+        vector<RawCanFrame> frames(BATCH_FRAMES);
+        uint8_t sequenceNumber = 1;
+        uint32_t canId = ids[0];
+
+        for (auto& frame : frames) {
+            const int roll = percent(random);
+            uint8_t pci = 0x20 | sequenceNumber;
+
+            if (roll < 5) { canId = ids[percent(random) % 3]; } // another session interleaves
+            else if (roll < 10) { pci = 0x20 | (percent(random) & 0x0f); } // lost or repeated CF
+            else if (roll < 20) { pci = static_cast<uint8_t>(percent(random) * 256 / 100); } // SF, FF, FC or reserved
+
+            memset(&frame, 0, sizeof(frame));
+            frame.canId = canId;
+            frame.length = 8;
+            frame.data[0] = pci;
+            sequenceNumber = ((pci & 0x0f) + 1) & 0x0f;
+        }
+
+        return frames;
+    }
+
+    /**
+     * @brief Runs a classification of the batch the given amount of times; returns ns per frame.
+     */
+    double measure(const size_t batches, const std::function<void()>& classify) {
+        classify(); // warm up caches and the classifier's arrays
+
+        const steady_clock::time_point start = steady_clock::now();
+        for (size_t i = 0; i < batches; i++) { classify(); }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now() - start).count();
+
+        return static_cast<double>(elapsed) / (batches * BATCH_FRAMES);
+    }
+
+    void report(const char* mode, const double nanosPerFrame) { printf("%-28s %10.2f\n", mode, nanosPerFrame); }
+
+}
+
+int main(int argc, char** argv) {
+    const size_t batches = argc > 1 ? strtoul(argv[1], nullptr, 10) : 20000;
+    const vector<RawCanFrame> frames = makeBatch();
+
+    if (batches == 0) {
+        fprintf(stderr, "usage: %s [batches=20000]\n", argv[0]);
+        return 1;
+    }
+
+    printf("classification of %zu-frame batches, %zu times, in ns/frame\n", BATCH_FRAMES, batches);
+    printf("%-28s %10s\n", "mode", "ns/frame");
+
+    report("per frame (buf_t)", measure(batches, [&frames]() {
+        for (const auto& raw : frames) {
+            const buf_t frame(raw.data, raw.data + raw.length);
+            g_sink = g_sink + static_cast<uint32_t>(types::getFrameType(frame[0]));
+        }
+    }));
+
+    const InstructionSet instructionSets[] = { InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::AVX2 };
+    const char* names[] = { "batch (scalar)", "batch (SSE2)", "batch (AVX2)" };
+
+    for (size_t i = 0; i < 3; i++) {
+        BatchClassifier classifier(instructionSets[i]);
+
+        if (classifier.getInstructionSet() != instructionSets[i]) {
+            printf("%-28s %10s\n", names[i], "n/a");
+            continue;
+        }
+
+        report(names[i], measure(batches, [&classifier, &frames]() {
+            g_sink = g_sink + classifier.classify(frames.data(), frames.size()).continuesRun[BATCH_FRAMES - 1];
+        }));
+    }
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file BatchClassifierTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Cross-checks the SIMD kernels of the batch classifier against the scalar path.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <memory>
+#include <random>
+#include <vector>
+
+// libc
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "BatchClassifier.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+using std::vector;
+
+namespace {
+
+    const uint32_t FILTERED_ID = 0x7df; //!< Frames with this ID are rejected by the acceptance filter
+
+    RawCanFrame makeFrame(const uint32_t canId, const uint8_t pci, const uint8_t length) {
+        RawCanFrame frame;
+
+        memset(&frame, 0, sizeof(frame));
+        frame.canId = canId;
+        frame.length = length;
+        frame.data[0] = pci;
+        frame.data[1] = 0x2a;
+
+        return frame;
+    }
+
+    /**
+     * @brief Generates frames of a few interleaved sessions, mostly CF runs with occasional broken sequences.
+     */
+    vector<RawCanFrame> makeBatch(std::minstd_rand& random, const size_t count) {
+        const uint32_t ids[] = { 0x7e0, 0x7e8, 0x18daf110, FILTERED_ID };
+        std::uniform_int_distribution<int> percent(0, 99);
+        vector<RawCanFrame> frames;
+        uint8_t sequenceNumber = 1;
+
+        frames.reserve(count);
+
+        for (size_t i = 0; i < count; i++) {
+            const int roll = percent(random);
+            uint32_t canId = frames.empty() ? ids[0] : frames.back().canId;
+            uint8_t pci = 0x20 | sequenceNumber;
+
+            if (roll < 5) { canId = ids[percent(random) % 4]; } // another session interleaves
+            else if (roll < 10) { pci = 0x20 | (percent(random) & 0x0f); } // lost or repeated CF
+            else if (roll < 20) { pci = static_cast<uint8_t>(percent(random) * 256 / 100); } // SF, FF, FC or reserved
+
+            frames.push_back(makeFrame(canId, pci, roll == 20 ? 0 : 8));
+            sequenceNumber = ((pci & 0x0f) + 1) & 0x0f;
+        }
+
+        return frames;
+    }
+
+    bool equalClassifications(const ClassifiedFrames& expected, const ClassifiedFrames& actual) {
+        if (expected.count != actual.count) { return false; }
+
+        for (size_t i = 0; i < expected.count; i++) {
+            if (expected.canIds[i] != actual.canIds[i] || expected.frameTypes[i] != actual.frameTypes[i] ||
+                expected.lowNibbles[i] != actual.lowNibbles[i] || !expected.continuesRun[i] != !actual.continuesRun[i] ||
+                expected.lengths[i] != actual.lengths[i]) {
+                fprintf(stderr, "frame %zu of %zu differs\n", i, expected.count);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void simdMatchesScalar() {
+        const std::shared_ptr<AcceptanceFilter> filter(new AcceptanceFilter());
+        BatchClassifier scalar(InstructionSet::SCALAR), sse2(InstructionSet::SSE2), avx2(InstructionSet::AVX2);
+        std::minstd_rand random(42);
+
+        filter->addId(CanId(0x7e0));
+        filter->addId(CanId(0x7e8));
+        filter->addId(CanId(0x18daf110));
+        scalar.setAcceptanceFilter(filter);
+        sse2.setAcceptanceFilter(filter);
+        avx2.setAcceptanceFilter(filter);
+
+        if (avx2.getInstructionSet() != InstructionSet::AVX2) { printf("AVX2 is not supported here; its kernel is not covered\n"); }
+        if (sse2.getInstructionSet() != InstructionSet::SSE2) { printf("SSE2 is not supported here; its kernel is not covered\n"); }
+
+        // every size up to 1000 covers each kernel's remainder handling at every offset
+        for (size_t count = 0; count <= 1000; count++) {
+            const vector<RawCanFrame> frames = makeBatch(random, count);
+            const ClassifiedFrames& expected = scalar.classify(frames.data(), count);
+
+            CHECK(equalClassifications(expected, sse2.classify(frames.data(), count)));
+            CHECK(equalClassifications(expected, avx2.classify(frames.data(), count)));
+        }
+    }
+
+    void rejectedFramesAreMarked() {
+        const std::shared_ptr<AcceptanceFilter> filter(new AcceptanceFilter());
+        BatchClassifier classifier;
+        const RawCanFrame frames[] = {
+            makeFrame(0x7e8, 0x10, 8), // FF
+            makeFrame(FILTERED_ID, 0x21, 8), // rejected by the filter
+            makeFrame(0x7e8, 0x21, 0), // empty
+            makeFrame(0x7e8, 0xff, 8), // accepted, of a reserved type
+            makeFrame(FILTERED_ID, 0xff, 8), // rejected, with the sentinel as its PCI byte
+        };
+
+        filter->addId(CanId(0x7e8));
+        classifier.setAcceptanceFilter(filter);
+
+        const ClassifiedFrames& batch = classifier.classify(frames, 5);
+        CHECK_EQUAL(static_cast<uint8_t>(FrameType::FIRST_FRAME), batch.frameTypes[0]);
+        CHECK_EQUAL(0x02a, batch.lengths[0]);
+        CHECK_EQUAL(BatchClassifier::REJECTED_FRAME, batch.frameTypes[1]);
+        CHECK_EQUAL(BatchClassifier::REJECTED_FRAME, batch.frameTypes[2]);
+        CHECK_EQUAL(0x0f, batch.frameTypes[3]);
+        CHECK_EQUAL(BatchClassifier::REJECTED_FRAME, batch.frameTypes[4]);
+    }
+
+    void ingestDispatchesRuns() {
+        BatchClassifier classifier;
+        vector<size_t> runs;
+        size_t singleFrames = 0;
+        vector<RawCanFrame> frames;
+
+        frames.push_back(makeFrame(0x7e8, 0x10, 8));
+        for (uint8_t i = 1; i <= 40; i++) { frames.push_back(makeFrame(0x7e8, 0x20 | (i & 0x0f), 8)); }
+        frames.push_back(makeFrame(0x7e0, 0x30, 3)); // FC of another session
+        for (uint8_t i = 9; i <= 12; i++) { frames.push_back(makeFrame(0x7e8, 0x20 | i, 8)); } // in sequence, but the FC ends the first run
+        frames.push_back(makeFrame(0x7e8, 0x2e, 8)); // SN 13 skipped
+
+        classifier.setConsecutiveFrameRunCallback([&runs](const ClassifiedFrames&, const size_t, const size_t count) { runs.push_back(count); })
+                  .setFrameCallback([&singleFrames](const ClassifiedFrames&, const size_t) { singleFrames++; });
+
+        CHECK_EQUAL(frames.size(), classifier.ingest(frames.data(), frames.size()));
+        CHECK_EQUAL(2u, singleFrames);
+        CHECK_EQUAL(3u, runs.size());
+        CHECK_EQUAL(40u, runs[0]);
+        CHECK_EQUAL(4u, runs[1]);
+        CHECK_EQUAL(1u, runs[2]);
+    }
+
+}
+
+int main() {
+    simdMatchesScalar();
+    rejectedFramesAreMarked();
+    ingestDispatchesRuns();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,176 @@
+/**
+ * @file BusLoadEstimatorTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Tests the frame timing of the bus-load estimator and the token bucket of the transmit rate limiter.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <stdexcept>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "BusLoadEstimator.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+namespace {
+
+    const CanId STANDARD_ID(0x7e0);
+    const CanId EXTENDED_ID(0x18da00f1 | CAN_EFF_FLAG);
+
+    void classicFrameLengths() {
+        // the well-known worst cases: 34 (SFF) or 54 (EFF) stuffable bits plus 8 per byte, one stuff bit per 4 after the first 5, 13 unstuffed bits
+        CHECK_EQUAL(55u, BusLoadEstimator::getFrameBitCount(STANDARD_ID, 0).nominalBits);
+        CHECK_EQUAL(135u, BusLoadEstimator::getFrameBitCount(STANDARD_ID, 8).nominalBits);
+        CHECK_EQUAL(80u, BusLoadEstimator::getFrameBitCount(EXTENDED_ID, 0).nominalBits);
+        CHECK_EQUAL(160u, BusLoadEstimator::getFrameBitCount(EXTENDED_ID, 8).nominalBits);
+        CHECK_EQUAL(0u, BusLoadEstimator::getFrameBitCount(STANDARD_ID, 8).dataBits);
+
+        // classic frames carry at most 8 bytes
+        CHECK_EQUAL(135u, BusLoadEstimator::getFrameBitCount(STANDARD_ID, 64).nominalBits);
+    }
+
+    void fdFrameLengths() {
+        /*
+         * SFF, 8 bytes, CRC-17:
+         *  SOF, ID, RRS, IDE, FDF, res, BRS   17 + 4 stuff bits
+         *  ESI, DLC, data                     5 + 64 + 17 stuff bits
+         *  stuff count, CRC                   4 + 17 + 6 fixed stuff bits
+         *  CRC delimiter                      1
+         *  ACK, delimiter, EOF, IFS           12
+         */
+        CHECK_EQUAL(147u, BusLoadEstimator::getFrameBitCount(STANDARD_ID, 8, true).nominalBits);
+
+        // 16 bytes is the last length with CRC-17; 17 bytes are sent as 20, with CRC-21 and one more fixed stuff bit
+        CHECK_EQUAL(227u, BusLoadEstimator::getFrameBitCount(STANDARD_ID, 16, true).nominalBits);
+        CHECK_EQUAL(272u, BusLoadEstimator::getFrameBitCount(STANDARD_ID, 17, true).nominalBits);
+        CHECK_EQUAL(272u, BusLoadEstimator::getFrameBitCount(STANDARD_ID, 20, true).nominalBits);
+        CHECK_EQUAL(712u, BusLoadEstimator::getFrameBitCount(STANDARD_ID, 64, true).nominalBits);
+
+        // with BRS, ESI through the CRC delimiter move to the data bitrate
+        FrameBitCount bits = BusLoadEstimator::getFrameBitCount(STANDARD_ID, 64, true, true);
+        CHECK_EQUAL(33u, bits.nominalBits);
+        CHECK_EQUAL(679u, bits.dataBits);
+
+        // EFF: 36 arbitration bits with 8 stuff bits
+        bits = BusLoadEstimator::getFrameBitCount(EXTENDED_ID, 64, true, true);
+        CHECK_EQUAL(56u, bits.nominalBits);
+        CHECK_EQUAL(680u, bits.dataBits);
+    }
+
+    void fdLengthRounding() {
+        const uint8_t lengths[][2] = { { 0, 0 }, { 8, 8 }, { 9, 12 }, { 12, 12 }, { 13, 16 }, { 17, 20 }, { 21, 24 }, { 25, 32 }, { 33, 48 }, { 49, 64 }, { 64, 64 }, { 100, 64 } };
+
+        for (const auto& length : lengths) { CHECK_EQUAL(length[1], BusLoadEstimator::getFdFrameLength(length[0])); }
+    }
+
+    void frameTimes() {
+        const BusLoadEstimator classic(500000);
+        const BusLoadEstimator fd(500000, 2000000);
+
+        CHECK_EQUAL(270000u, classic.getFrameTimeNanos(STANDARD_ID, 8)); // 135 bits at 2us
+        CHECK_EQUAL(66000u + 339500u, fd.getFrameTimeNanos(STANDARD_ID, 64, true, true)); // 33 bits at 2us, 679 at 0.5us
+        CHECK_EQUAL(1424000u, fd.getFrameTimeNanos(STANDARD_ID, 64, true)); // without BRS, all 712 bits at 2us
+
+        CHECK_EQUAL(500000u, fd.getNominalBitrate());
+        CHECK_EQUAL(2000000u, fd.getDataBitrate());
+        CHECK_EQUAL(500000u, classic.getDataBitrate()); // defaults to the nominal bitrate
+    }
+
+    void zeroBitrateIsRejected() {
+        bool thrown = false;
+
+        try { BusLoadEstimator estimator(0); } catch (const std::invalid_argument&) { thrown = true; }
+        CHECK(thrown);
+
+        thrown = false;
+        try { TransmitRateLimiter limiter(0, 2000000); } catch (const std::invalid_argument&) { thrown = true; }
+        CHECK(thrown);
+    }
+
+    void slidingWindow() {
+        BusLoadEstimator estimator(500000, 0, microseconds(1000000));
+
+        estimator.recordFrame(10000000, 0); // 10ms of bus time
+        estimator.recordFrame(40000000, 550000);
+        CHECK_EQUAL(2u, estimator.getTotalFrames());
+        CHECK_EQUAL(50000000u, estimator.getTotalBusTimeNanos());
+        CHECK(estimator.getUtilisation(900000) > 0.0499 && estimator.getUtilisation(900000) < 0.0501);
+
+        // the first frame has left the 1s window, the second has not
+        CHECK(estimator.getUtilisation(1050000) > 0.0399 && estimator.getUtilisation(1050000) < 0.0401);
+        CHECK_EQUAL(0.0, estimator.getUtilisation(2000000));
+    }
+
+    void tokenBucket() {
+        uint64_t now = 0;
+        TransmitRateLimiter limiter(500000);
+
+        limiter.setClockCallback([&now]() { return now; });
+
+        // unlimited until a share is set
+        for (int i = 0; i < 100; i++) { CHECK(limiter.tryAcquire(STANDARD_ID, 8)); }
+
+        // a 1ms burst holds 3.7 frames of 270us; the fourth goes into debt, the fifth is denied
+        limiter.setBandwidthShare(0.5, microseconds(1000));
+        for (int i = 0; i < 4; i++) {
+            CHECK(limiter.tryAcquire(STANDARD_ID, 8));
+            limiter.commit(STANDARD_ID, 8, true);
+        }
+        CHECK(!limiter.tryAcquire(STANDARD_ID, 8));
+        CHECK_EQUAL(1u, limiter.getThrottledFrames());
+        CHECK_EQUAL(4u, limiter.getEstimator().getTotalFrames());
+
+        // paying off 80us of debt at half the wall-clock time takes 160us
+        now = 159;
+        CHECK(!limiter.tryAcquire(STANDARD_ID, 8));
+        now = 160;
+        CHECK(limiter.tryAcquire(STANDARD_ID, 8));
+        limiter.commit(STANDARD_ID, 8, true);
+        CHECK(limiter.getUtilisation() > 0);
+    }
+
+    void failedSendsAreRefunded() {
+        uint64_t now = 0;
+        TransmitRateLimiter limiter(500000);
+
+        limiter.setClockCallback([&now]() { return now; });
+        limiter.setBandwidthShare(0.5, microseconds(1000));
+
+        // however often the bus rejects a frame, the budget stays intact
+        for (int i = 0; i < 100; i++) {
+            CHECK(limiter.tryAcquire(STANDARD_ID, 8));
+            limiter.commit(STANDARD_ID, 8, false);
+        }
+        CHECK_EQUAL(0u, limiter.getEstimator().getTotalFrames());
+
+        for (int i = 0; i < 4; i++) { CHECK(limiter.tryAcquire(STANDARD_ID, 8)); }
+        CHECK(!limiter.tryAcquire(STANDARD_ID, 8));
+    }
+
+}
+
+int main() {
+    classicFrameLengths();
+    fdFrameLengths();
+    fdLengthRounding();
+    frameTimes();
+    zeroBitrateIsRejected();
+    slidingWindow();
+    tokenBucket();
+    failedSendsAreRefunded();
+
+    return TEST_RESULT();
+}
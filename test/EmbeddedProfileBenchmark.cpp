@@ -0,0 +1,182 @@
+/**
+ * @file EmbeddedProfileBenchmark.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Measures the per-frame cost and the footprint of the embedded profile's engine against the default transmit path.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <chrono>
+
+// libc
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "StaticIsoTp.hpp"
+#include "TransmitScheduler.hpp"
+
+/*
+ * Sends 4095-byte messages over a loopback without a bus, with BS 0 and STmin 0, and reports the time per frame:
+ *
+ *  - transmit: the engine segments a message; its FC is answered right away, frames are dropped once sent
+ *  - send + receive: a second engine reassembles the message and answers the FF with FC
+ *
+ *  usage: embedded_profile_benchmark [messages=20000]
+ *
+ * These are the README's "Embedded profile" figures. The target builds with the tree's -O2; the -Os figures are the
+ * same program built by hand:
+ *
+ *  g++ -std=c++11 -Os -Iinclude test/EmbeddedProfileBenchmark.cpp src/StaticIsoTp.cpp src/TransmitScheduler.cpp \
+ *      src/BusLoadEstimator.cpp src/PeerParameterCache.cpp -lpthread
+ *
+ * Code size is not measured here; it is the text size (`size -t`) of the objects: the library built with
+ * -Disotpp_EMBEDDED=ON, and TransmitScheduler.cpp.o, BusLoadEstimator.cpp.o and PeerParameterCache.cpp.o of the default build.
+ */
+
+using namespace isotpp;
+
+using std::chrono::steady_clock;
+
+namespace {
+
+    const uint32_t REQUEST_ID = 0x7e0;
+    const uint32_t RESPONSE_ID = 0x7e8;
+    const uint16_t MESSAGE_LENGTH = types::ISOTP_MAX_MESSAGE_LENGTH;
+    const uint8_t CONTINUE[] = { 0x30, 0x00, 0x00 };
+
+    using engine_t = StaticIsoTp<4, 4095>;
+
+    uint8_t g_message[MESSAGE_LENGTH];
+
+    /**
+     * @brief One direction of the loopback: the last frame an engine sent, until the main loop hands it to the other engine.
+     */
+    struct Link {
+        size_t              frames;
+        bool                pending;
+        uint32_t            canId;
+        uint8_t             length;
+        uint8_t             data[CAN_MAX_DLEN];
+    };
+
+    uint64_t getTick() { return 0; }
+
+    bool countCanFrame(void* context, const uint32_t, const uint8_t*, const uint8_t) {
+        (*static_cast<size_t*>(context))++;
+        return true;
+    }
+
+    bool sendCanFrame(void* context, const uint32_t canId, const uint8_t* frame, const uint8_t length) {
+        Link* link = static_cast<Link*>(context);
+
+        link->frames++;
+        link->pending = true;
+        link->canId = canId;
+        link->length = length;
+        memcpy(link->data, frame, length);
+
+        return true;
+    }
+
+    double nanosPerFrame(const steady_clock::time_point start, const size_t frames) {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now() - start).count()) / frames;
+    }
+
+    double measureStaticTransmit(const size_t messages) {
+        static engine_t sender;
+        size_t frames = 0;
+
+        sender.setContext(&frames).setSendCallback(countCanFrame).setTickCallback(getTick);
+        sender.openSession(REQUEST_ID, RESPONSE_ID);
+
+        const steady_clock::time_point start = steady_clock::now();
+        for (size_t i = 0; i < messages; i++) {
+            sender.send(REQUEST_ID, g_message, MESSAGE_LENGTH);
+            sender.handleIncomingCanFrame(RESPONSE_ID, CONTINUE, sizeof(CONTINUE));
+            sender.poll();
+        }
+
+        return nanosPerFrame(start, frames);
+    }
+
+    double measureStaticLoopback(const size_t messages) {
+        static engine_t sender, receiver;
+        Link request = {}, response = {};
+
+        sender.setContext(&request).setSendCallback(sendCanFrame).setTickCallback(getTick);
+        receiver.setContext(&response).setSendCallback(sendCanFrame).setTickCallback(getTick).setBlockSize(0);
+        sender.openSession(REQUEST_ID, RESPONSE_ID);
+        receiver.openSession(RESPONSE_ID, REQUEST_ID);
+
+        const steady_clock::time_point start = steady_clock::now();
+        for (size_t i = 0; i < messages; i++) {
+            sender.send(REQUEST_ID, g_message, MESSAGE_LENGTH);
+
+            // every frame crosses the link before the next one is sent, as on a bus
+            do {
+                if (request.pending) {
+                    request.pending = false;
+                    receiver.handleIncomingCanFrame(request.canId, request.data, request.length);
+                }
+                if (response.pending) {
+                    response.pending = false;
+                    sender.handleIncomingCanFrame(response.canId, response.data, response.length);
+                }
+                sender.poll();
+            } while (request.pending || response.pending);
+        }
+
+        return nanosPerFrame(start, request.frames + response.frames);
+    }
+
+    double measureSchedulerTransmit(const size_t messages) {
+        TransmitScheduler scheduler;
+        const buf_t message(g_message, g_message + MESSAGE_LENGTH);
+        size_t frames = 0;
+
+        scheduler.setSendCallback([&frames](const CanId&, const buf_t&) { frames++; return true; })
+                 .setTickCallback([]() { return static_cast<uint64_t>(0); });
+
+        const steady_clock::time_point start = steady_clock::now();
+        for (size_t i = 0; i < messages; i++) {
+            scheduler.enqueue(message, CanId(REQUEST_ID));
+            scheduler.poll();
+            scheduler.handleFlowControlFrame(CanId(REQUEST_ID), FlowControlFlag::CONTINUE, 0, 0);
+            scheduler.poll();
+        }
+
+        return nanosPerFrame(start, frames);
+    }
+
+}
+
+int main(int argc, char** argv) {
+    const size_t messages = argc > 1 ? strtoul(argv[1], nullptr, 10) : 20000;
+
+    if (messages == 0) {
+        fprintf(stderr, "usage: %s [messages=20000]\n", argv[0]);
+        return 1;
+    }
+
+    for (size_t i = 0; i < MESSAGE_LENGTH; i++) { g_message[i] = static_cast<uint8_t>(i); }
+
+    printf("%zu messages of %u bytes, BS 0, STmin 0, loopback without a bus\n", messages, MESSAGE_LENGTH);
+    printf("%-44s %10s\n", "", "ns/frame");
+    printf("%-44s %10.1f\n", "TransmitScheduler, transmit", measureSchedulerTransmit(messages));
+    printf("%-44s %10.1f\n", "StaticIsoTp<4, 4095>, transmit", measureStaticTransmit(messages));
+    printf("%-44s %10.1f\n", "StaticIsoTp<4, 4095>, send + receive", measureStaticLoopback(messages));
+    printf("sizeof(StaticIsoTp<4, 4095>): %zu bytes\n", sizeof(engine_t));
+
+    return 0;
+}
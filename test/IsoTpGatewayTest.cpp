@@ -0,0 +1,287 @@
+/**
+ * @file IsoTpGatewayTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Tests cut-through forwarding of the ISO-TP gateway, its handling of new messages arriving mid-transfer and its admission of FFs.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <memory>
+#include <utility>
+#include <vector>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "IsoTpGateway.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+using std::pair;
+using std::shared_ptr;
+using std::vector;
+
+namespace {
+
+    const CanId TESTER_TX(0x7e0); //!< The tester's requests on bus A
+    const CanId TESTER_RX(0x7e8); //!< The gateway's FCs to the tester
+    const CanId ECU_RX(0x600); //!< The forwarded requests on bus B
+    const CanId ECU_TX(0x680); //!< The ECU's FCs on bus B
+
+    typedef pair<uint32_t, buf_t> sentframe_t;
+
+    /**
+     * @brief A gateway routing the tester on bus A to an ECU on bus B, recording what it sends on either bus.
+     */
+    struct Harness {
+        IsoTpGateway        gateway;
+        uint64_t            now;
+        vector<sentframe_t> busA;
+        vector<sentframe_t> busB;
+
+        Harness(): gateway(8, 16), now(0) {
+            gateway.setTickCallback([this]() { return now; })
+                   .setTimeout(milliseconds(1000))
+                   .setSendCallback(BusSide::BUS_A, [this](const CanId& canId, const buf_t& frame) { busA.emplace_back(static_cast<uint32_t>(canId), frame); return true; })
+                   .setSendCallback(BusSide::BUS_B, [this](const CanId& canId, const buf_t& frame) { busB.emplace_back(static_cast<uint32_t>(canId), frame); return true; });
+            gateway.addRoute(GatewayRoute(BusSide::BUS_A, TESTER_TX, TESTER_RX, ECU_RX, ECU_TX));
+        }
+
+        ReturnValue fromTester(const buf_t& frame) { return gateway.handleIncomingCanFrame(BusSide::BUS_A, TESTER_TX, frame); }
+        ReturnValue fromEcu(const buf_t& frame) { return gateway.handleIncomingCanFrame(BusSide::BUS_B, ECU_TX, frame); }
+
+        static buf_t firstFrame(const uint16_t length) { return buf_t{ static_cast<uint8_t>(0x10 | (length >> 8)), static_cast<uint8_t>(length), 0x2e, 0xf1, 0x90, 0x01, 0x02, 0x03 }; }
+        static buf_t consecutiveFrame(const uint8_t index) {
+            buf_t frame(8, index);
+            frame[0] = 0x20 | (index & 0x0f);
+
+            return frame;
+        }
+    };
+
+    const buf_t TESTER_PRESENT = { 0x02, 0x3e, 0x80 };
+
+    /**
+     * @brief Checks that bus B carried the FF and CFs 1 to count, in order, starting at the given index.
+     */
+    void checkForwardedMessage(const vector<sentframe_t>& bus, const size_t start, const uint16_t length, const uint8_t count) {
+        CHECK(bus.size() >= start + 1u + count);
+        if (bus.size() < start + 1u + count) { return; }
+
+        CHECK_EQUAL(0x600u, bus[start].first);
+        CHECK(bus[start].second == Harness::firstFrame(length));
+        for (uint8_t i = 1; i <= count; i++) {
+            CHECK_EQUAL(0x600u, bus[start + i].first);
+            CHECK(bus[start + i].second == Harness::consecutiveFrame(i));
+        }
+    }
+
+    void singleFramesPassThrough() {
+        Harness harness;
+
+        CHECK(harness.fromTester(TESTER_PRESENT) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(1u, harness.busB.size());
+        CHECK_EQUAL(0x600u, harness.busB[0].first);
+        CHECK(harness.busB[0].second == TESTER_PRESENT);
+
+        // other IDs are not routed
+        CHECK(harness.gateway.handleIncomingCanFrame(BusSide::BUS_A, CanId(0x7e1), TESTER_PRESENT) == ReturnValue::NO_ROUTE);
+    }
+
+    void cutThrough() {
+        Harness harness;
+
+        // the FF is forwarded at once; the tester only gets its FC once the ECU has answered
+        CHECK(harness.fromTester(Harness::firstFrame(50)) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(1u, harness.busB.size());
+        CHECK(harness.busA.empty());
+
+        CHECK(harness.fromEcu(buf_t{ 0x30, 0x00, 0x00 }) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(1u, harness.busA.size());
+        CHECK_EQUAL(0x7e8u, harness.busA[0].first);
+        CHECK(harness.busA[0].second == types::makeFlowControlFrame(FlowControlFlag::CONTINUE, 8, 0));
+
+        // each CF leaves as soon as it arrives: 6 + 6 * 7 + 2 bytes
+        for (uint8_t i = 1; i <= 7; i++) {
+            CHECK(harness.fromTester(Harness::consecutiveFrame(i)) == ReturnValue::SUCCESS);
+            CHECK_EQUAL(1u + i, harness.busB.size());
+        }
+        checkForwardedMessage(harness.busB, 0, 50, 7);
+
+        // the transfer is over
+        CHECK(harness.fromTester(Harness::consecutiveFrame(8)) == ReturnValue::UNEXPECTED_FRAME);
+    }
+
+    void receiverBlocksAndSeparation() {
+        Harness harness;
+
+        harness.fromTester(Harness::firstFrame(50));
+        harness.fromEcu(buf_t{ 0x30, 0x02, 0x0a }); // BS 2, STmin 10ms
+
+        for (uint8_t i = 1; i <= 7; i++) { harness.fromTester(Harness::consecutiveFrame(i)); }
+        CHECK_EQUAL(2u, harness.busB.size()); // the FF and the first CF; the rest waits for STmin
+
+        harness.now = 10;
+        harness.gateway.poll();
+        CHECK_EQUAL(3u, harness.busB.size()); // end of the ECU's block
+
+        harness.now = 100;
+        harness.gateway.poll();
+        CHECK_EQUAL(3u, harness.busB.size());
+
+        harness.fromEcu(buf_t{ 0x30, 0x02, 0x0a });
+        CHECK_EQUAL(4u, harness.busB.size());
+    }
+
+    void messagesWaitForTheDrainingOne() {
+        Harness harness;
+
+        harness.fromTester(Harness::firstFrame(50));
+        harness.fromEcu(buf_t{ 0x30, 0x00, 0x0a }); // STmin 10ms
+        for (uint8_t i = 1; i <= 7; i++) { harness.fromTester(Harness::consecutiveFrame(i)); }
+        CHECK_EQUAL(2u, harness.busB.size());
+
+        // the tester is done and moves on; its message must still reach the ECU in full
+        CHECK(harness.fromTester(TESTER_PRESENT) == ReturnValue::SUCCESS);
+        CHECK(harness.fromTester(Harness::firstFrame(20)) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(2u, harness.busB.size());
+
+        // the held FF is answered with WAIT, and kept waiting
+        CHECK(harness.busA.back().second == types::makeFlowControlFrame(FlowControlFlag::WAIT, 0, 0));
+        const size_t flowControls = harness.busA.size();
+
+        for (uint64_t tick = 10; tick <= 60; tick += 10) {
+            harness.now = tick;
+            harness.gateway.poll();
+        }
+        checkForwardedMessage(harness.busB, 0, 50, 7);
+
+        // then the held messages follow
+        CHECK_EQUAL(10u, harness.busB.size());
+        CHECK(harness.busB[8].second == TESTER_PRESENT);
+        CHECK(harness.busB[9].second == Harness::firstFrame(20));
+        CHECK_EQUAL(flowControls, harness.busA.size());
+
+        harness.fromEcu(buf_t{ 0x30, 0x00, 0x00 });
+        CHECK(harness.busA.back().second == types::makeFlowControlFrame(FlowControlFlag::CONTINUE, 8, 0));
+        harness.fromTester(Harness::consecutiveFrame(1));
+        harness.fromTester(Harness::consecutiveFrame(2));
+        checkForwardedMessage(harness.busB, 9, 20, 2);
+    }
+
+    void heldFirstFramesAreKeptAlive() {
+        Harness harness;
+
+        harness.fromTester(Harness::firstFrame(20));
+        harness.fromEcu(buf_t{ 0x30, 0x01, 0x00 }); // BS 1
+        harness.fromTester(Harness::consecutiveFrame(1));
+        harness.fromTester(Harness::consecutiveFrame(2));
+        harness.fromTester(Harness::firstFrame(30));
+        const size_t flowControls = harness.busA.size();
+
+        // the ECU is slow to grant its next block; the tester must not give up in the meantime
+        harness.now = 500;
+        harness.gateway.poll();
+        CHECK_EQUAL(flowControls + 1, harness.busA.size());
+        CHECK(harness.busA.back().second == types::makeFlowControlFrame(FlowControlFlag::WAIT, 0, 0));
+
+        harness.fromEcu(buf_t{ 0x30, 0x01, 0x00 });
+        checkForwardedMessage(harness.busB, 0, 20, 2);
+        CHECK(harness.busB.back().second == Harness::firstFrame(30));
+    }
+
+    void newMessagesAbortIncompleteOnes() {
+        Harness harness;
+
+        harness.fromTester(Harness::firstFrame(50));
+        harness.fromEcu(buf_t{ 0x30, 0x00, 0x00 });
+        harness.fromTester(Harness::consecutiveFrame(1));
+        harness.fromTester(Harness::consecutiveFrame(2));
+
+        // the tester abandons its message; the SF goes straight through
+        CHECK(harness.fromTester(TESTER_PRESENT) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(4u, harness.busB.size());
+        CHECK(harness.busB.back().second == TESTER_PRESENT);
+        CHECK(harness.fromTester(Harness::consecutiveFrame(3)) == ReturnValue::UNEXPECTED_FRAME);
+
+        // likewise for a FF
+        harness.fromTester(Harness::firstFrame(50));
+        harness.fromEcu(buf_t{ 0x30, 0x00, 0x00 });
+        harness.fromTester(Harness::consecutiveFrame(1));
+        CHECK(harness.fromTester(Harness::firstFrame(20)) == ReturnValue::SUCCESS);
+        CHECK(harness.busB.back().second == Harness::firstFrame(20));
+    }
+
+    void repeatedFirstFramesCountWaits() {
+        Harness harness;
+        const shared_ptr<ReassemblyBudget> budget(new ReassemblyBudget(100, 100, 2));
+
+        harness.gateway.setReassemblyBudget(budget);
+        budget->admit(CanId(0x123), 100); // another user of the budget takes all of it
+
+        // a sender repeating its FF instead of waiting for the gateway's next FC is still rejected after N_WFTmax
+        CHECK(harness.fromTester(Harness::firstFrame(50)) == ReturnValue::SUCCESS);
+        CHECK(harness.fromTester(Harness::firstFrame(50)) == ReturnValue::SUCCESS);
+        CHECK(harness.busA.back().second == types::makeFlowControlFrame(FlowControlFlag::WAIT, 0, 0));
+        CHECK(harness.fromTester(Harness::firstFrame(50)) == ReturnValue::OVERFLOW);
+        CHECK(harness.busA.back().second == types::makeFlowControlFrame(FlowControlFlag::ABORT_TRANSMISSION, 0, 0));
+        CHECK(harness.busB.empty());
+
+        // once there is room, the next FF goes through
+        budget->release(CanId(0x123));
+        CHECK(harness.fromTester(Harness::firstFrame(50)) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(1u, harness.busB.size());
+        CHECK_EQUAL(50u, budget->getStatistics().bytesInUse);
+    }
+
+    void budgetKeyedByBus() {
+        Harness harness;
+        const shared_ptr<ReassemblyBudget> budget(new ReassemblyBudget(100, 100));
+
+        // the ECU's bus uses the tester's request ID for a route in the other direction
+        harness.gateway.setReassemblyBudget(budget);
+        CHECK(harness.gateway.addRoute(GatewayRoute(BusSide::BUS_B, TESTER_TX, TESTER_RX, CanId(0x700), CanId(0x708))) == ReturnValue::SUCCESS);
+
+        CHECK(harness.fromTester(Harness::firstFrame(60)) == ReturnValue::SUCCESS);
+        CHECK(harness.gateway.handleIncomingCanFrame(BusSide::BUS_B, TESTER_TX, Harness::firstFrame(60)) == ReturnValue::SUCCESS);
+
+        // the second message does not fit next to the first, rather than replacing its reservation
+        CHECK_EQUAL(60u, budget->getStatistics().bytesInUse);
+        CHECK_EQUAL(0x7e8u, harness.busB.back().first);
+        CHECK(harness.busB.back().second == types::makeFlowControlFrame(FlowControlFlag::WAIT, 0, 0));
+        CHECK(harness.busA.empty());
+    }
+
+    void classicCanOnly() {
+        Harness harness;
+
+        CHECK(harness.fromTester(buf_t(12, 0x00)) == ReturnValue::INVALID_LENGTH);
+        CHECK(harness.fromTester(buf_t()) == ReturnValue::INVALID_LENGTH);
+        CHECK(harness.busB.empty());
+    }
+
+}
+
+int main() {
+    singleFramesPassThrough();
+    cutThrough();
+    receiverBlocksAndSeparation();
+    messagesWaitForTheDrainingOne();
+    heldFirstFramesAreKeptAlive();
+    newMessagesAbortIncompleteOnes();
+    repeatedFirstFramesCountWaits();
+    budgetKeyedByBus();
+    classicCanOnly();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,192 @@
+/**
+ * @file LatencyPollerBenchmark.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Measures the FF -> FC turnaround of the busy-polling mode against sleep-based polling.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+// libc
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "LatencyPoller.hpp"
+#include "StaticIsoTp.hpp"
+
+/*
+ * A peer thread sends a FF every 50 - 500us, at a random phase relative to the poller. The poller hands it to the
+ * engine, which answers with FC CONTINUE; the turnaround is the time from the FF being posted to the FC being sent.
+ *
+ *  usage: latency_poller_benchmark [samples=10000] [cpu=-1] [rt]
+ *
+ * Pin the poller to an otherwise idle CPU for meaningful busy-polling numbers; on a single CPU the peer and the
+ * poller compete for the same core. "rt" runs the poller with SCHED_FIFO, which requires CAP_SYS_NICE.
+ */
+
+using namespace isotpp;
+
+using std::atomic;
+using std::chrono::steady_clock;
+using std::vector;
+
+namespace {
+
+    const int SLEEP_INTERVAL_MILLIS = 1; //!< The interval of the sleep-based poller
+    const uint32_t REQUEST_ID = 0x7e0;
+    const uint32_t RESPONSE_ID = 0x7e8;
+    const uint8_t FIRST_FRAME[] = { 0x10, 0x20, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+
+    using engine_t = StaticIsoTp<1, 64>;
+
+    /**
+     * @brief The state shared by the peer and the poller.
+     */
+    struct Bench {
+        engine_t            engine;
+
+        atomic<uint32_t>    posted; //!< The sequence number of the last FF posted by the peer
+        atomic<uint32_t>    answered; //!< The sequence number of the last FF answered with FC
+        atomic<int64_t>     answeredAt; //!< The time the last FC was sent, in ns
+        uint32_t            consumed; //!< The sequence number of the last FF handed to the engine; poller only
+    };
+
+    int64_t nowNanos() { return std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now().time_since_epoch()).count(); }
+
+    uint64_t getTick() { return std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now().time_since_epoch()).count(); }
+
+    bool sendCanFrame(void* context, const uint32_t, const uint8_t*, const uint8_t) {
+        Bench* bench = static_cast<Bench*>(context);
+
+        bench->answeredAt.store(nowNanos(), std::memory_order_relaxed);
+        bench->answered.store(bench->consumed, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief The ingest path: hands a posted FF to the engine.
+     */
+    bool ingest(Bench& bench) {
+        const uint32_t posted = bench.posted.load(std::memory_order_acquire);
+        if (posted == bench.consumed) { return false; }
+
+        bench.consumed = posted;
+        bench.engine.handleIncomingCanFrame(REQUEST_ID, FIRST_FRAME, sizeof(FIRST_FRAME));
+
+        return true;
+    }
+
+    /**
+     * @brief Posts samples FFs and records the turnaround of each, in ns.
+     */
+    vector<int64_t> runPeer(Bench& bench, const size_t samples) {
+        std::minstd_rand random(42);
+        std::uniform_int_distribution<int> gap(50, 500);
+        vector<int64_t> turnarounds;
+
+        turnarounds.reserve(samples);
+
+        for (uint32_t i = 1; i <= samples; i++) {
+            std::this_thread::sleep_for(std::chrono::microseconds(gap(random)));
+
+            const int64_t postedAt = nowNanos();
+            bench.posted.store(i, std::memory_order_release);
+
+            while (bench.answered.load(std::memory_order_acquire) != i) { std::this_thread::yield(); }
+
+            turnarounds.push_back(bench.answeredAt.load(std::memory_order_relaxed) - postedAt);
+        }
+
+        return turnarounds;
+    }
+
+    void resetBench(Bench& bench) {
+        bench.posted = 0;
+        bench.answered = 0;
+        bench.answeredAt = 0;
+        bench.consumed = 0;
+    }
+
+    void report(const char* mode, vector<int64_t> turnarounds) {
+        std::sort(turnarounds.begin(), turnarounds.end());
+
+        const auto percentile = [&turnarounds](const double p) {
+            return turnarounds[std::min(turnarounds.size() - 1, static_cast<size_t>(p * turnarounds.size()))] / 1000.0;
+        };
+
+        printf("%-28s %10.1f %10.1f %10.1f %10.1f\n", mode, percentile(0.5), percentile(0.99), percentile(0.999), turnarounds.back() / 1000.0);
+    }
+
+}
+
+int main(int argc, char** argv) {
+    const size_t samples = argc > 1 ? strtoul(argv[1], nullptr, 10) : 10000;
+    LatencyPollerConfig config;
+
+    config.cpu = argc > 2 ? atoi(argv[2]) : -1;
+    config.realtime = argc > 3 && strcmp(argv[3], "rt") == 0;
+
+    if (samples == 0) {
+        fprintf(stderr, "usage: %s [samples=10000] [cpu=-1] [rt]\n", argv[0]);
+        return 1;
+    }
+
+    static Bench bench;
+    bench.engine.setContext(&bench).setSendCallback(sendCanFrame).setTickCallback(getTick);
+    bench.engine.openSession(RESPONSE_ID, REQUEST_ID);
+
+    printf("FF -> FC turnaround over %zu samples, in us\n", samples);
+    printf("%-28s %10s %10s %10s %10s\n", "mode", "p50", "p99", "p99.9", "max");
+
+    {
+        atomic<bool> keepPolling(true);
+
+        resetBench(bench);
+        std::thread poller([&keepPolling]() {
+            while (keepPolling) {
+                ingest(bench);
+                std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_INTERVAL_MILLIS));
+            }
+        });
+
+        const vector<int64_t> turnarounds = runPeer(bench, samples);
+        keepPolling = false;
+        poller.join();
+
+        report("sleep-based (1 ms)", turnarounds);
+    }
+
+    resetBench(bench);
+    LatencyPoller poller([]() { return ingest(bench); });
+
+    if (poller.start(config) != ReturnValue::SUCCESS) {
+        fprintf(stderr, "could not start the latency poller: %s\n", strerror(errno));
+        return 1;
+    }
+
+    const vector<int64_t> turnarounds = runPeer(bench, samples);
+    poller.stop();
+
+    report(config.realtime ? "busy-poll (SCHED_FIFO)" : config.cpu >= 0 ? "busy-poll (pinned)" : "busy-poll", turnarounds);
+
+    return 0;
+}
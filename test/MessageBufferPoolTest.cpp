@@ -0,0 +1,193 @@
+/**
+ * @file MessageBufferPoolTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Tests lending, zero-copy delivery and reuse of the reassembly buffer pool.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "MessageBufferPool.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+using std::vector;
+
+namespace {
+
+    std::atomic<size_t> g_allocations(0); //!< Counts every heap allocation of the program
+
+}
+
+void* operator new(size_t size) {
+    g_allocations++;
+
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) { throw std::bad_alloc(); }
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+
+namespace {
+
+    const CanId RX_ID(0x7e8);
+
+    void exhaustionAndReturn() {
+        MessageBufferPool pool(2, 64);
+
+        CHECK_EQUAL(2u, pool.getCapacity());
+        CHECK_EQUAL(2u, pool.getAvailable());
+
+        shared_ptr<buf_t> first = pool.acquire();
+        shared_ptr<buf_t> second = pool.acquire();
+        CHECK(first && second && first != second);
+        CHECK_EQUAL(0u, pool.getAvailable());
+
+        // an exhausted pool lends nothing, rather than growing
+        CHECK(!pool.acquire());
+
+        // a returned buffer comes back cleared, with its capacity retained
+        first->assign(50, 0xaa);
+        const buf_t* address = first.get();
+        first.reset();
+        CHECK_EQUAL(1u, pool.getAvailable());
+
+        first = pool.acquire();
+        CHECK(first.get() == address);
+        CHECK(first->empty());
+        CHECK(first->capacity() >= 64);
+    }
+
+    void deliverSharesOneBuffer() {
+        MessageBufferPool pool(1, 64);
+        vector<msghandle_t> received;
+
+        for (int i = 0; i < 3; i++) {
+            pool.addConsumer([&received](const CanId& canId, const msghandle_t& handle) {
+                CHECK_EQUAL(0x7e8u, static_cast<uint32_t>(canId));
+                received.push_back(handle);
+            });
+        }
+
+        shared_ptr<buf_t> buffer = pool.acquire();
+        const buf_t* address = buffer.get();
+        buffer->assign({ 0x62, 0xf1, 0x90 });
+
+        CHECK_EQUAL(3u, pool.deliver(RX_ID, buffer));
+        CHECK(!buffer); // the engine's reference was handed over
+
+        // every consumer holds the very same buffer
+        CHECK_EQUAL(3u, received.size());
+        for (const auto& handle : received) { CHECK(handle.get() == address); }
+        CHECK(*received[0] == (buf_t{ 0x62, 0xf1, 0x90 }));
+
+        // the buffer only returns once the last consumer lets go
+        received.pop_back();
+        received.pop_back();
+        CHECK_EQUAL(0u, pool.getAvailable());
+        CHECK(!pool.acquire());
+        received.clear();
+        CHECK_EQUAL(1u, pool.getAvailable());
+    }
+
+    void steadyStateAllocatesNothing() {
+        MessageBufferPool pool(2, 64);
+        vector<msghandle_t> received;
+
+        received.reserve(2);
+        pool.addConsumer([&received](const CanId&, const msghandle_t& handle) { received.push_back(handle); });
+        pool.addConsumer([&received](const CanId&, const msghandle_t& handle) { received.push_back(handle); });
+
+        const size_t before = g_allocations;
+        for (int i = 0; i < 1000; i++) {
+            shared_ptr<buf_t> buffer = pool.acquire();
+            if (!buffer) {
+                CHECK(buffer);
+                break;
+            }
+
+            buffer->assign(8, static_cast<uint8_t>(i));
+            pool.deliver(RX_ID, buffer);
+            received.clear();
+        }
+
+        // the buffers and their control blocks are reused
+        CHECK_EQUAL(before, static_cast<size_t>(g_allocations));
+        CHECK_EQUAL(2u, pool.getAvailable());
+    }
+
+    void weakReferencesFallBackToTheHeap() {
+        MessageBufferPool pool(1, 64);
+        std::weak_ptr<buf_t> observer;
+
+        {
+            shared_ptr<buf_t> buffer = pool.acquire();
+            observer = buffer;
+        }
+
+        // the buffer is back, but its control block is kept alive by the weak_ptr
+        CHECK_EQUAL(1u, pool.getAvailable());
+        CHECK(observer.expired());
+
+        size_t before = g_allocations;
+        shared_ptr<buf_t> buffer = pool.acquire();
+        CHECK(buffer);
+        CHECK_EQUAL(before + 1, static_cast<size_t>(g_allocations));
+        buffer.reset();
+
+        // once the weak_ptr is gone, the slot is used again
+        observer.reset();
+        before = g_allocations;
+        buffer = pool.acquire();
+        buffer.reset();
+        buffer = pool.acquire();
+        CHECK_EQUAL(before, static_cast<size_t>(g_allocations));
+    }
+
+    void handlesOutliveThePool() {
+        msghandle_t handle;
+
+        {
+            MessageBufferPool pool(1, 64);
+            shared_ptr<buf_t> buffer = pool.acquire();
+
+            buffer->assign({ 0x01, 0x02 });
+            handle = pool.publish(buffer);
+        }
+
+        CHECK(*handle == (buf_t{ 0x01, 0x02 }));
+        handle.reset();
+    }
+
+}
+
+int main() {
+    exhaustionAndReturn();
+    deliverSharesOneBuffer();
+    steadyStateAllocatesNothing();
+    weakReferencesFallBackToTheHeap();
+    handlesOutliveThePool();
+
+    return TEST_RESULT();
+}
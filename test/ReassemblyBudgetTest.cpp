@@ -0,0 +1,128 @@
+/**
+ * @file ReassemblyBudgetTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Tests the admission decisions of the reassembly budget.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "ReassemblyBudget.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+namespace {
+
+    const CanId FIRST(0x7e0);
+    const CanId SECOND(0x7e1);
+    const CanId THIRD(0x7e2);
+
+    void admitAndRelease() {
+        ReassemblyBudget budget(100, 60);
+
+        CHECK(budget.admit(FIRST, 50) == FlowControlFlag::CONTINUE);
+        CHECK_EQUAL(50u, budget.getStatistics().bytesInUse);
+
+        // fits the session limit, but not next to the first message
+        CHECK(budget.admit(SECOND, 60) == FlowControlFlag::WAIT);
+
+        budget.release(FIRST);
+        CHECK_EQUAL(0u, budget.getStatistics().bytesInUse);
+        CHECK(budget.admit(SECOND, 60) == FlowControlFlag::CONTINUE);
+
+        // a new message replaces the session's previous reservation
+        CHECK(budget.admit(SECOND, 30) == FlowControlFlag::CONTINUE);
+        CHECK_EQUAL(30u, budget.getStatistics().bytesInUse);
+        CHECK(budget.admit(FIRST, 70) == FlowControlFlag::ABORT_TRANSMISSION); // above the session limit
+        CHECK(budget.admit(FIRST, 60) == FlowControlFlag::CONTINUE);
+        CHECK_EQUAL(90u, budget.getStatistics().bytesInUse);
+
+        // releasing unknown sessions is harmless
+        budget.release(THIRD);
+        CHECK_EQUAL(90u, budget.getStatistics().bytesInUse);
+
+        const ReassemblyBudgetStatistics statistics = budget.getStatistics();
+        CHECK_EQUAL(4u, statistics.admitted);
+        CHECK_EQUAL(1u, statistics.waited);
+        CHECK_EQUAL(1u, statistics.rejected);
+        CHECK_EQUAL(90u, statistics.peakBytesInUse);
+    }
+
+    void waitsAreLimited() {
+        ReassemblyBudget budget(100, 100, 3);
+
+        CHECK(budget.admit(FIRST, 100) == FlowControlFlag::CONTINUE);
+
+        for (int i = 0; i < 3; i++) { CHECK(budget.admit(SECOND, 10) == FlowControlFlag::WAIT); }
+        CHECK(budget.admit(SECOND, 10) == FlowControlFlag::ABORT_TRANSMISSION);
+        CHECK_EQUAL(3u, budget.getStatistics().waited);
+        CHECK_EQUAL(1u, budget.getStatistics().rejected);
+
+        // a rejected session starts counting anew
+        CHECK(budget.admit(SECOND, 10) == FlowControlFlag::WAIT);
+
+        // as does one which gave up waiting
+        budget.release(SECOND);
+        for (int i = 0; i < 3; i++) { CHECK(budget.admit(SECOND, 10) == FlowControlFlag::WAIT); }
+
+        // once there is room, a waiting session is admitted
+        budget.release(FIRST);
+        CHECK(budget.admit(SECOND, 10) == FlowControlFlag::CONTINUE);
+    }
+
+    void waitingSessionsAreBounded() {
+        ReassemblyBudget budget(100, 100, 2, 2);
+
+        budget.admit(FIRST, 100);
+        budget.admit(SECOND, 10);
+        budget.admit(SECOND, 10);
+        budget.admit(THIRD, 10);
+
+        // the second session waited least recently, and makes room for a fourth
+        CHECK(budget.admit(CanId(0x7e3), 10) == FlowControlFlag::WAIT);
+        CHECK_EQUAL(1u, budget.getStatistics().forgotten);
+        CHECK(budget.admit(SECOND, 10) == FlowControlFlag::WAIT);
+
+        // without room for waiting sessions, messages which do not fit are rejected at once
+        ReassemblyBudget strict(100, 100, 2, 0);
+        strict.admit(FIRST, 100);
+        CHECK(strict.admit(SECOND, 10) == FlowControlFlag::ABORT_TRANSMISSION);
+    }
+
+    void sessionKeys() {
+        ReassemblyBudget budget(100, 100);
+        const uint64_t otherBus = (1ull << 32) | static_cast<uint32_t>(FIRST);
+
+        // the same ID on another bus is another session
+        CHECK(budget.admit(FIRST, 50) == FlowControlFlag::CONTINUE);
+        CHECK(budget.admit(otherBus, 50) == FlowControlFlag::CONTINUE);
+        CHECK_EQUAL(100u, budget.getStatistics().bytesInUse);
+
+        // an ID is the key of bus 0
+        budget.release(static_cast<uint64_t>(static_cast<uint32_t>(FIRST)));
+        CHECK_EQUAL(50u, budget.getStatistics().bytesInUse);
+        budget.release(otherBus);
+        CHECK_EQUAL(0u, budget.getStatistics().bytesInUse);
+    }
+
+}
+
+int main() {
+    admitAndRelease();
+    waitsAreLimited();
+    waitingSessionsAreBounded();
+    sessionKeys();
+
+    return TEST_RESULT();
+}
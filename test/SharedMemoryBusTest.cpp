@@ -0,0 +1,289 @@
+/**
+ * @file SharedMemoryBusTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Tests the shared-memory transport with an in-process stand-in owner.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// libc
+#include <errno.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "SharedMemoryBus.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+using std::vector;
+
+namespace {
+
+    /**
+     * @brief A frame as passed to a receive or send callback.
+     */
+    struct Frame {
+        uint32_t            canId;
+        buf_t               data;
+    };
+
+    rxframecb_t collectInto(vector<Frame>& frames) {
+        return [&frames](const CanId& canId, const uint8_t* data, const uint8_t length) {
+            frames.push_back(Frame{ static_cast<uint32_t>(canId), buf_t(data, data + length) });
+        };
+    }
+
+    void publishAndReceive() {
+        SharedMemoryBusOwner owner(8, 8);
+        SharedMemoryBusClient first, second;
+        vector<Frame> firstFrames, secondFrames;
+        const uint8_t data[] = { 0x02, 0x10, 0x03 };
+
+        CHECK_EQUAL(ReturnValue::ERROR, first.attach(owner)); // no region yet
+        CHECK_EQUAL(ReturnValue::SUCCESS, owner.createInProcess());
+        CHECK_EQUAL(ReturnValue::IN_PROGRESS, owner.createInProcess());
+        CHECK_EQUAL(ReturnValue::SUCCESS, first.attach(owner));
+        CHECK_EQUAL(ReturnValue::SUCCESS, second.attach(owner));
+        CHECK_EQUAL(ReturnValue::IN_PROGRESS, second.attach(owner));
+
+        CHECK_EQUAL(ReturnValue::SUCCESS, owner.publish(CanId(0x7e8), data, sizeof(data)));
+        CHECK_EQUAL(ReturnValue::SUCCESS, owner.publish(CanId(0x7e9), data, 1));
+
+        // every client sees every frame, in order
+        CHECK_EQUAL(2u, first.receive(collectInto(firstFrames)));
+        CHECK_EQUAL(2u, second.receive(collectInto(secondFrames)));
+        CHECK_EQUAL(0u, first.receive(collectInto(firstFrames)));
+
+        CHECK_EQUAL(2u, firstFrames.size());
+        CHECK_EQUAL(2u, secondFrames.size());
+        CHECK_EQUAL(0x7e8u, firstFrames[0].canId);
+        CHECK(firstFrames[0].data == buf_t(data, data + sizeof(data)));
+        CHECK_EQUAL(0x7e9u, secondFrames[1].canId);
+        CHECK_EQUAL(1u, secondFrames[1].data.size());
+
+        // maxFrames leaves the rest for the next call
+        for (uint8_t i = 0; i < 3; i++) { owner.publish(CanId(0x100 + i), &i, 1); }
+        firstFrames.clear();
+        CHECK_EQUAL(1u, first.receive(collectInto(firstFrames), 1));
+        CHECK_EQUAL(2u, first.receive(collectInto(firstFrames)));
+        CHECK_EQUAL(0x102u, firstFrames[2].canId);
+
+        // a client only sees frames published after attaching
+        SharedMemoryBusClient late;
+        vector<Frame> lateFrames;
+        CHECK_EQUAL(ReturnValue::SUCCESS, late.attach(owner));
+        CHECK_EQUAL(0u, late.receive(collectInto(lateFrames)));
+
+        CHECK_EQUAL(ReturnValue::INVALID_LENGTH, owner.publish(CanId(0x7e8), data, CANFD_MAX_DLEN + 1));
+    }
+
+    void acceptanceFilter() {
+        SharedMemoryBusOwner owner(8, 8);
+        SharedMemoryBusClient client;
+        const std::shared_ptr<AcceptanceFilter> filter(new AcceptanceFilter());
+        vector<Frame> frames;
+        const uint8_t data[] = { 0x01, 0x3e };
+
+        owner.createInProcess();
+        client.attach(owner);
+        filter->addId(CanId(0x7e8));
+        client.setAcceptanceFilter(filter);
+
+        owner.publish(CanId(0x123), data, sizeof(data));
+        owner.publish(CanId(0x7e8), data, sizeof(data));
+        owner.publish(CanId(0x456), data, sizeof(data));
+
+        CHECK_EQUAL(1u, client.receive(collectInto(frames)));
+        CHECK_EQUAL(0x7e8u, frames[0].canId);
+        CHECK_EQUAL(0u, client.getLostFrames()); // rejected frames are not lost frames
+    }
+
+    void lappingCountsLostFrames() {
+        SharedMemoryBusOwner owner(8, 8);
+        SharedMemoryBusClient slow, fast;
+        vector<Frame> slowFrames, fastFrames;
+
+        owner.createInProcess();
+        slow.attach(owner);
+        fast.attach(owner);
+
+        for (uint8_t i = 0; i < 20; i++) {
+            owner.publish(CanId(0x200 + i), &i, 1);
+            if (i % 4 == 3) { fast.receive(collectInto(fastFrames)); }
+        }
+
+        // the ring holds 8 frames, so the slow client lost the oldest 12
+        CHECK_EQUAL(8u, slow.receive(collectInto(slowFrames)));
+        CHECK_EQUAL(12u, slow.getLostFrames());
+        CHECK_EQUAL(0x200u + 12, slowFrames.front().canId);
+        CHECK_EQUAL(0x200u + 19, slowFrames.back().canId);
+
+        CHECK_EQUAL(20u, fastFrames.size());
+        CHECK_EQUAL(0u, fast.getLostFrames());
+
+        // having caught up, the slow client loses nothing further
+        const uint8_t data = 0;
+        owner.publish(CanId(0x300), &data, 1);
+        slowFrames.clear();
+        CHECK_EQUAL(1u, slow.receive(collectInto(slowFrames)));
+        CHECK_EQUAL(12u, slow.getLostFrames());
+    }
+
+    void sendAndDrain() {
+        SharedMemoryBusOwner owner(8, 4);
+        SharedMemoryBusClient client;
+        vector<Frame> sent;
+        const sendcancb_t socket = [&sent](const CanId& canId, const buf_t& frame) {
+            sent.push_back(Frame{ static_cast<uint32_t>(canId), frame });
+            return true;
+        };
+
+        CHECK(!client.send(CanId(0x7e0), buf_t{ 0x02, 0x10, 0x03 })); // not attached
+        owner.createInProcess();
+        client.attach(owner);
+
+        for (uint8_t i = 0; i < 4; i++) { CHECK(client.send(CanId(0x7e0), buf_t{ 0x01, i })); }
+        CHECK(!client.send(CanId(0x7e0), buf_t{ 0x01, 0xff })); // full
+        CHECK(!client.send(CanId(0x7e0), buf_t(CANFD_MAX_DLEN + 1, 0)));
+
+        CHECK_EQUAL(2u, owner.drainTransmitQueue(socket, 2));
+        CHECK_EQUAL(2u, owner.drainTransmitQueue(socket));
+        CHECK_EQUAL(0u, owner.drainTransmitQueue(socket));
+
+        CHECK_EQUAL(4u, sent.size());
+        for (uint8_t i = 0; i < sent.size(); i++) {
+            CHECK_EQUAL(0x7e0u, sent[i].canId);
+            CHECK(sent[i].data == (buf_t{ 0x01, i }));
+        }
+
+        // the queue is reusable once drained
+        CHECK(client.send(CanId(0x7e0), buf_t{ 0x01, 0x42 }));
+        CHECK_EQUAL(1u, owner.drainTransmitQueue(socket));
+    }
+
+    void failedSendStaysQueued() {
+        SharedMemoryBusOwner owner(8, 4);
+        SharedMemoryBusClient client;
+        bool socketUp = false;
+        vector<Frame> sent;
+        const sendcancb_t socket = [&socketUp, &sent](const CanId& canId, const buf_t& frame) {
+            if (!socketUp) { return false; } // e.g. ENOBUFS or bus-off
+            sent.push_back(Frame{ static_cast<uint32_t>(canId), frame });
+            return true;
+        };
+
+        owner.createInProcess();
+        client.attach(owner);
+        CHECK(client.send(CanId(0x7e0), buf_t{ 0x01, 0x01 }));
+        CHECK(client.send(CanId(0x7e0), buf_t{ 0x01, 0x02 }));
+
+        CHECK_EQUAL(0u, owner.drainTransmitQueue(socket));
+        CHECK_EQUAL(1u, owner.getSendFailures());
+        CHECK(sent.empty());
+
+        socketUp = true;
+        CHECK_EQUAL(2u, owner.drainTransmitQueue(socket));
+        CHECK_EQUAL(2u, sent.size());
+        CHECK(sent[0].data == (buf_t{ 0x01, 0x01 })); // nothing lost, order kept
+        CHECK(sent[1].data == (buf_t{ 0x01, 0x02 }));
+    }
+
+    void concurrentSenders() {
+        const size_t SENDERS = 4;
+        const size_t FRAMES_PER_SENDER = 5000;
+
+        SharedMemoryBusOwner owner(8, 64);
+        SharedMemoryBusClient clients[SENDERS];
+        std::atomic<size_t> finished(0);
+        vector<uint32_t> nextPerSender(SENDERS, 0);
+        size_t received = 0;
+        bool ordered = true;
+
+        owner.createInProcess();
+
+        vector<std::thread> senders;
+        for (size_t s = 0; s < SENDERS; s++) {
+            clients[s].attach(owner);
+            senders.push_back(std::thread([&clients, &finished, s, FRAMES_PER_SENDER]() {
+                for (uint32_t i = 0; i < FRAMES_PER_SENDER; i++) {
+                    const buf_t frame{ static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8) };
+                    while (!clients[s].send(CanId(static_cast<uint32_t>(0x700 + s)), frame)) { std::this_thread::yield(); }
+                }
+                finished++;
+            }));
+        }
+
+        const sendcancb_t socket = [&](const CanId& canId, const buf_t& frame) {
+            const size_t sender = static_cast<uint32_t>(canId) - 0x700;
+            const uint32_t sequence = frame[0] | (frame[1] << 8);
+
+            if (sender >= SENDERS || sequence != (nextPerSender[sender] & 0xffff)) { ordered = false; }
+            else { nextPerSender[sender]++; }
+
+            received++;
+            return true;
+        };
+
+        while (finished < SENDERS) { owner.drainTransmitQueue(socket); }
+        owner.drainTransmitQueue(socket);
+        for (auto& sender : senders) { sender.join(); }
+
+        // every frame arrives exactly once, and each sender's frames in order
+        CHECK_EQUAL(SENDERS * FRAMES_PER_SENDER, received);
+        CHECK(ordered);
+    }
+
+    void namedRegionIsNotReplaced() {
+        const std::string name = "/isotpp-test-" + std::to_string(getpid());
+        SharedMemoryBusOwner live(8, 8), second(8, 8), replacement(8, 8);
+        SharedMemoryBusClient client, lateClient;
+        vector<Frame> frames;
+        const uint8_t data = 0x55;
+
+        CHECK_EQUAL(ReturnValue::SUCCESS, live.create(name));
+        CHECK_EQUAL(ReturnValue::SUCCESS, client.attach(name));
+
+        // a second owner must not truncate the live region
+        errno = 0;
+        CHECK_EQUAL(ReturnValue::ERROR, second.create(name));
+        CHECK_EQUAL(EEXIST, errno);
+
+        live.publish(CanId(0x7e8), &data, 1);
+        CHECK_EQUAL(1u, client.receive(collectInto(frames)));
+
+        // replacing is explicit; clients of the old region keep their mapping
+        CHECK_EQUAL(ReturnValue::SUCCESS, replacement.create(name, true));
+        live.publish(CanId(0x7e8), &data, 1);
+        CHECK_EQUAL(1u, client.receive(collectInto(frames)));
+        CHECK_EQUAL(ReturnValue::SUCCESS, lateClient.attach(name));
+    }
+
+}
+
+int main() {
+    publishAndReceive();
+    acceptanceFilter();
+    lappingCountsLostFrames();
+    sendAndDrain();
+    failedSendStaysQueued();
+    concurrentSenders();
+    namedRegionIsNotReplaced();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,311 @@
+/**
+ * @file StaticIsoTpTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Tests sending and receiving with the statically sized engine of the embedded profile.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <vector>
+
+// libc
+#include <stdint.h>
+#include <string.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "StaticIsoTp.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+using std::vector;
+
+namespace {
+
+    const uint32_t TX_ID = 0x7e0;
+    const uint32_t RX_ID = 0x7e8;
+
+    using engine_t = StaticIsoTp<2, 128>;
+
+    uint64_t g_now; //!< The tick callback has no context
+
+    uint64_t getTick() { return g_now; }
+
+    /**
+     * @brief An engine with an open session, recording everything it sends, receives and completes.
+     */
+    struct Harness {
+        engine_t                engine;
+        vector<vector<uint8_t>> sent;
+        vector<vector<uint8_t>> received;
+        vector<ReturnValue>     completions;
+
+        Harness() {
+            g_now = 0;
+            engine.setContext(this).setSendCallback(sendCanFrame).setReceiveCallback(receive).setCompletionCallback(complete).setTickCallback(getTick);
+            engine.openSession(TX_ID, RX_ID);
+        }
+
+        ReturnValue fromPeer(const vector<uint8_t>& frame) { return engine.handleIncomingCanFrame(RX_ID, frame.data(), static_cast<uint8_t>(frame.size())); }
+
+        static bool sendCanFrame(void* context, const uint32_t canId, const uint8_t* frame, const uint8_t length) {
+            CHECK_EQUAL(TX_ID, canId);
+            static_cast<Harness*>(context)->sent.emplace_back(frame, frame + length);
+            return true;
+        }
+
+        static void receive(void* context, const uint32_t rxId, const uint8_t* data, const uint16_t length) {
+            CHECK_EQUAL(RX_ID, rxId);
+            static_cast<Harness*>(context)->received.emplace_back(data, data + length);
+        }
+
+        static void complete(void* context, const uint32_t txId, const ReturnValue result) {
+            CHECK_EQUAL(TX_ID, txId);
+            static_cast<Harness*>(context)->completions.push_back(result);
+        }
+    };
+
+    uint8_t g_message[4096]; //!< Byte i holds i; sent messages must outlive the call to send()
+
+    vector<uint8_t> firstFrame(const uint16_t length) { return { static_cast<uint8_t>(0x10 | (length >> 8)), static_cast<uint8_t>(length), 0, 1, 2, 3, 4, 5 }; }
+
+    vector<uint8_t> consecutiveFrame(const uint8_t sequenceNumber, const uint16_t offset) {
+        vector<uint8_t> frame = { static_cast<uint8_t>(0x20 | (sequenceNumber & 0x0f)) };
+        for (uint16_t i = 0; i < types::CONSECUTIVE_FRAME_MAX_DATA; i++) { frame.push_back(static_cast<uint8_t>(offset + i)); }
+        return frame;
+    }
+
+    void sessions() {
+        engine_t engine;
+
+        CHECK(engine.openSession(TX_ID, RX_ID) == ReturnValue::SUCCESS);
+        CHECK(engine.openSession(TX_ID, 0x7e9) == ReturnValue::IN_PROGRESS);
+        CHECK(engine.openSession(0x7e1, 0x7e9) == ReturnValue::SUCCESS);
+        CHECK(engine.openSession(0x7e2, 0x7ea) == ReturnValue::BUFFER_FULL);
+
+        CHECK(engine.closeSession(0x7e9) == ReturnValue::SUCCESS);
+        CHECK(engine.closeSession(0x7e9) == ReturnValue::NO_ROUTE);
+        CHECK(engine.openSession(0x7e2, 0x7ea) == ReturnValue::SUCCESS);
+    }
+
+    void singleFrames() {
+        Harness harness;
+
+        CHECK(harness.engine.send(TX_ID, g_message, 7) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(1u, harness.sent.size());
+        CHECK(harness.sent[0] == (vector<uint8_t>{ 0x07, 0, 1, 2, 3, 4, 5, 6 }));
+        CHECK_EQUAL(1u, harness.completions.size());
+        CHECK(harness.completions[0] == ReturnValue::SUCCESS);
+
+        CHECK(harness.fromPeer({ 0x03, 0x62, 0xf1, 0x90 }) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(1u, harness.received.size());
+        CHECK(harness.received[0] == (vector<uint8_t>{ 0x62, 0xf1, 0x90 }));
+
+        // invalid lengths and unknown IDs
+        CHECK(harness.engine.send(TX_ID, g_message, 0) == ReturnValue::INVALID_LENGTH);
+        CHECK(harness.engine.send(TX_ID, g_message, 4096) == ReturnValue::OVERFLOW);
+        CHECK(harness.engine.send(0x123, g_message, 7) == ReturnValue::NO_ROUTE);
+        CHECK(harness.fromPeer({ 0x00, 0x62 }) == ReturnValue::INVALID_LENGTH);
+        CHECK(harness.fromPeer({ 0x05, 0x62, 0xf1 }) == ReturnValue::INVALID_LENGTH);
+        CHECK(harness.engine.handleIncomingCanFrame(0x123, g_message, 8) == ReturnValue::NO_ROUTE);
+    }
+
+    void sendInBlocks() {
+        Harness harness;
+
+        // 6 + 3 * 7 + 3 bytes
+        CHECK(harness.engine.send(TX_ID, g_message, 30) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(1u, harness.sent.size());
+        CHECK(harness.sent[0] == firstFrame(30));
+        CHECK(harness.engine.send(TX_ID, g_message, 30) == ReturnValue::IN_PROGRESS);
+
+        harness.engine.poll();
+        CHECK_EQUAL(1u, harness.sent.size()); // no CFs before the FC
+
+        CHECK(harness.fromPeer({ 0x30, 0x02, 0x00 }) == ReturnValue::SUCCESS);
+        harness.engine.poll();
+        CHECK_EQUAL(3u, harness.sent.size());
+        CHECK(harness.sent[1] == consecutiveFrame(1, 6));
+        CHECK(harness.sent[2] == consecutiveFrame(2, 13));
+
+        harness.engine.poll();
+        CHECK_EQUAL(3u, harness.sent.size()); // end of the block
+
+        CHECK(harness.fromPeer({ 0x30, 0x02, 0x00 }) == ReturnValue::SUCCESS);
+        harness.engine.poll();
+        CHECK_EQUAL(5u, harness.sent.size());
+        CHECK(harness.sent[3] == consecutiveFrame(3, 20));
+        CHECK(harness.sent[4] == (vector<uint8_t>{ 0x24, 27, 28, 29 }));
+        CHECK_EQUAL(1u, harness.completions.size());
+        CHECK(harness.completions[0] == ReturnValue::SUCCESS);
+
+        // a FC out of turn
+        CHECK(harness.fromPeer({ 0x30, 0x00, 0x00 }) == ReturnValue::UNEXPECTED_FRAME);
+    }
+
+    void sendWithSeparationTime() {
+        Harness harness;
+
+        harness.engine.send(TX_ID, g_message, 30);
+        harness.fromPeer({ 0x30, 0x00, 0x05 }); // STmin 5ms
+
+        harness.engine.poll();
+        CHECK_EQUAL(2u, harness.sent.size());
+
+        g_now = 4;
+        harness.engine.poll();
+        CHECK_EQUAL(2u, harness.sent.size());
+
+        g_now = 5;
+        harness.engine.poll();
+        CHECK_EQUAL(3u, harness.sent.size());
+    }
+
+    void flowControlWaitAndOverflow() {
+        Harness harness;
+
+        harness.engine.send(TX_ID, g_message, 30);
+
+        // WAIT restarts N_Bs
+        g_now = 900;
+        CHECK(harness.fromPeer({ 0x31, 0x00, 0x00 }) == ReturnValue::SUCCESS);
+        g_now = 1500;
+        harness.engine.poll();
+        CHECK(harness.completions.empty());
+
+        CHECK(harness.fromPeer({ 0x30, 0x00, 0x00 }) == ReturnValue::SUCCESS);
+        harness.engine.poll();
+        CHECK_EQUAL(5u, harness.sent.size());
+        CHECK_EQUAL(1u, harness.completions.size());
+
+        // OVERFLOW ends the transmission
+        harness.engine.send(TX_ID, g_message, 30);
+        CHECK(harness.fromPeer({ 0x32, 0x00, 0x00 }) == ReturnValue::OVERFLOW);
+        CHECK_EQUAL(2u, harness.completions.size());
+        CHECK(harness.completions[1] == ReturnValue::OVERFLOW);
+        CHECK(harness.engine.send(TX_ID, g_message, 7) == ReturnValue::SUCCESS);
+
+        // a FC too short to carry BS and STmin
+        harness.engine.send(TX_ID, g_message, 30);
+        CHECK(harness.fromPeer({ 0x30 }) == ReturnValue::INVALID_LENGTH);
+    }
+
+    void receiveInBlocks() {
+        Harness harness;
+
+        harness.engine.setBlockSize(2).setSeparationTime(0x0a);
+
+        CHECK(harness.fromPeer(firstFrame(30)) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(1u, harness.sent.size());
+        CHECK(harness.sent[0] == (vector<uint8_t>{ 0x30, 0x02, 0x0a }));
+
+        CHECK(harness.fromPeer(consecutiveFrame(1, 6)) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(1u, harness.sent.size());
+        CHECK(harness.fromPeer(consecutiveFrame(2, 13)) == ReturnValue::SUCCESS);
+        CHECK_EQUAL(2u, harness.sent.size()); // the next block is granted
+
+        CHECK(harness.fromPeer(consecutiveFrame(3, 20)) == ReturnValue::SUCCESS);
+        CHECK(harness.received.empty());
+        CHECK(harness.fromPeer({ 0x24, 27, 28, 29 }) == ReturnValue::SUCCESS);
+
+        CHECK_EQUAL(1u, harness.received.size());
+        CHECK_EQUAL(30u, harness.received[0].size());
+        CHECK(memcmp(harness.received[0].data(), g_message, 30) == 0);
+        CHECK_EQUAL(2u, harness.sent.size()); // no FC after the last CF
+    }
+
+    void sequenceErrors() {
+        Harness harness;
+
+        harness.fromPeer(firstFrame(30));
+        CHECK(harness.fromPeer(consecutiveFrame(2, 6)) == ReturnValue::UNEXPECTED_FRAME);
+
+        // the message was dropped
+        CHECK(harness.fromPeer(consecutiveFrame(1, 6)) == ReturnValue::UNEXPECTED_FRAME);
+
+        // sequence numbers wrap from 15 to 0
+        harness.engine.setBlockSize(0);
+        harness.fromPeer(firstFrame(6 + 17 * 7));
+        for (uint8_t i = 1; i <= 17; i++) { CHECK(harness.fromPeer(consecutiveFrame(i, 6 + (i - 1) * 7)) == ReturnValue::SUCCESS); }
+        CHECK_EQUAL(1u, harness.received.size());
+
+        // CFs without a FF, and CFs shorter than their payload
+        CHECK(harness.fromPeer(consecutiveFrame(1, 6)) == ReturnValue::UNEXPECTED_FRAME);
+        harness.fromPeer(firstFrame(30));
+        CHECK(harness.fromPeer({ 0x21, 6, 7 }) == ReturnValue::INVALID_LENGTH);
+    }
+
+    void timeouts() {
+        Harness harness;
+
+        // N_Bs: no FC after the FF
+        harness.engine.send(TX_ID, g_message, 30);
+        g_now = 999;
+        harness.engine.poll();
+        CHECK(harness.completions.empty());
+        g_now = 1000;
+        harness.engine.poll();
+        CHECK_EQUAL(1u, harness.completions.size());
+        CHECK(harness.completions[0] == ReturnValue::TIMEOUT_OCCURRED);
+
+        // N_Bs: no FC after a block
+        harness.engine.send(TX_ID, g_message, 30);
+        harness.fromPeer({ 0x30, 0x01, 0x00 });
+        harness.engine.poll();
+        g_now = 2000;
+        harness.engine.poll();
+        CHECK_EQUAL(2u, harness.completions.size());
+        CHECK(harness.completions[1] == ReturnValue::TIMEOUT_OCCURRED);
+
+        // N_Cr: no CF within the timeout
+        harness.fromPeer(firstFrame(30));
+        harness.fromPeer(consecutiveFrame(1, 6));
+        g_now = 3000;
+        harness.engine.poll();
+        CHECK(harness.fromPeer(consecutiveFrame(2, 13)) == ReturnValue::UNEXPECTED_FRAME);
+        CHECK(harness.received.empty());
+    }
+
+    void messageSizeOverflow() {
+        Harness harness;
+
+        // one byte more than the reassembly buffer holds
+        CHECK(harness.fromPeer(firstFrame(129)) == ReturnValue::OVERFLOW);
+        CHECK_EQUAL(1u, harness.sent.size());
+        CHECK(harness.sent[0] == (vector<uint8_t>{ 0x32, 0x08, 0x00 }));
+        CHECK(harness.fromPeer(consecutiveFrame(1, 6)) == ReturnValue::UNEXPECTED_FRAME);
+
+        // exactly the buffer's size fits
+        CHECK(harness.fromPeer(firstFrame(128)) == ReturnValue::SUCCESS);
+        CHECK(harness.sent.back() == (vector<uint8_t>{ 0x30, 0x08, 0x00 }));
+
+        // FFs must be full frames announcing a multi-frame message
+        CHECK(harness.fromPeer({ 0x10, 0x40, 0, 1 }) == ReturnValue::INVALID_LENGTH);
+        CHECK(harness.fromPeer(firstFrame(7)) == ReturnValue::INVALID_LENGTH);
+    }
+
+}
+
+int main() {
+    for (size_t i = 0; i < sizeof(g_message); i++) { g_message[i] = static_cast<uint8_t>(i); }
+
+    sessions();
+    singleFrames();
+    sendInBlocks();
+    sendWithSeparationTime();
+    flowControlWaitAndOverflow();
+    receiveInBlocks();
+    sequenceErrors();
+    timeouts();
+    messageSizeOverflow();
+
+    return TEST_RESULT();
+}
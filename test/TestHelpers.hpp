@@ -0,0 +1,43 @@
+/**
+ * @file TestHelpers.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the minimal assertion helpers shared by the test programs.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef ISOTPP_TEST_TESTHELPERS_HPP
+#define ISOTPP_TEST_TESTHELPERS_HPP
+
+// libc
+#include <stdio.h>
+
+/*
+ * Each test program is a plain executable registered with CTest; it returns the amount of failed checks.
+ * CHECK() reports a failure and carries on, so a single run shows every broken expectation.
+ */
+
+static int g_failedChecks = 0;
+
+#define CHECK(condition) do { \
+        if (!(condition)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            g_failedChecks++; \
+        } \
+    } while (0)
+
+#define CHECK_EQUAL(expected, actual) do { \
+        const auto expectedValue = (expected); \
+        const auto actualValue = (actual); \
+        if (!(expectedValue == actualValue)) { \
+            fprintf(stderr, "%s:%d: check failed: %s == %s (%lld != %lld)\n", __FILE__, __LINE__, #expected, #actual, \
+                    static_cast<long long>(expectedValue), static_cast<long long>(actualValue)); \
+            g_failedChecks++; \
+        } \
+    } while (0)
+
+#define TEST_RESULT() (g_failedChecks == 0 ? 0 : (fprintf(stderr, "%d check(s) failed\n", g_failedChecks), 1))
+
+#endif // ISOTPP_TEST_TESTHELPERS_HPP
@@ -0,0 +1,330 @@
+/**
+ * @file TransmitSchedulerTest.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Tests the frame order, flow control and timeouts of the transmit scheduler.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+/////////////////////
+// SYSTEM INCLUDES //
+/////////////////////
+// stl
+#include <memory>
+#include <vector>
+
+// libc
+#include <stdint.h>
+
+/////////////////////
+// LOCAL  INCLUDES //
+/////////////////////
+#include "TransmitScheduler.hpp"
+#include "TestHelpers.hpp"
+
+using namespace isotpp;
+
+using std::vector;
+
+namespace {
+
+    /**
+     * @brief A frame as passed to the send callback.
+     */
+    struct Frame {
+        uint32_t            canId;
+        buf_t               data;
+    };
+
+    /**
+     * @brief A message completion as passed to the completion callback.
+     */
+    struct Completion {
+        uint32_t            canId;
+        ReturnValue         result;
+    };
+
+    /**
+     * @brief A scheduler wired to a recording bus and a manually advanced clock.
+     */
+    struct Harness {
+        explicit            Harness(const size_t maxQueueDepth = TransmitScheduler::DEFAULT_QUEUE_DEPTH): scheduler(maxQueueDepth), now(0), busUp(true) {
+            scheduler.setSendCallback([this](const CanId& canId, const buf_t& frame) {
+                if (!busUp) { return false; }
+                sent.push_back(Frame{ static_cast<uint32_t>(canId), frame });
+                return true;
+            }).setTickCallback([this]() { return now; })
+              .setCompletionCallback([this](const CanId& canId, const ReturnValue result) {
+                completions.push_back(Completion{ static_cast<uint32_t>(canId), result });
+            });
+        }
+
+        TransmitScheduler   scheduler;
+        uint64_t            now;
+        bool                busUp;
+        vector<Frame>       sent;
+        vector<Completion>  completions;
+    };
+
+    buf_t makeMessage(const size_t length) {
+        buf_t message(length);
+        for (size_t i = 0; i < length; i++) { message[i] = static_cast<uint8_t>(i); }
+        return message;
+    }
+
+    void singleFrames() {
+        Harness harness;
+
+        CHECK_EQUAL(ReturnValue::INVALID_LENGTH, harness.scheduler.enqueue(buf_t(), CanId(0x7e0)));
+        CHECK_EQUAL(ReturnValue::OVERFLOW, harness.scheduler.enqueue(makeMessage(4096), CanId(0x7e0)));
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.scheduler.enqueue(buf_t{ 0x3e, 0x00 }, CanId(0x7e0)));
+        CHECK_EQUAL(1u, harness.scheduler.getPendingMessages());
+
+        CHECK_EQUAL(1u, harness.scheduler.poll());
+        CHECK_EQUAL(0u, harness.scheduler.poll());
+        CHECK_EQUAL(0u, harness.scheduler.getPendingMessages());
+
+        CHECK_EQUAL(1u, harness.sent.size());
+        CHECK(harness.sent[0].data == (buf_t{ 0x02, 0x3e, 0x00 }));
+        CHECK_EQUAL(1u, harness.completions.size());
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.completions[0].result);
+
+        // a frame the bus rejects fails the message
+        harness.busUp = false;
+        harness.scheduler.enqueue(buf_t{ 0x3e, 0x00 }, CanId(0x7e0));
+        CHECK_EQUAL(1u, harness.scheduler.poll()); // the attempt counts as sent
+        CHECK_EQUAL(ReturnValue::ERROR, harness.completions.back().result);
+    }
+
+    void blockSizeAndFlowControl() {
+        Harness harness;
+
+        // FF with 6 bytes, then 7 CFs carrying 44 bytes
+        harness.scheduler.enqueue(makeMessage(50), CanId(0x7e0));
+        CHECK_EQUAL(1u, harness.scheduler.poll());
+        CHECK(harness.sent[0].data == (buf_t{ 0x10, 50, 0, 1, 2, 3, 4, 5 }));
+        CHECK_EQUAL(0u, harness.scheduler.poll()); // waiting for FC
+
+        CHECK_EQUAL(ReturnValue::UNEXPECTED_FRAME, harness.scheduler.handleFlowControlFrame(CanId(0x7e1), FlowControlFlag::CONTINUE, 0, 0));
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::CONTINUE, 2, 0));
+        CHECK_EQUAL(2u, harness.scheduler.poll());
+        CHECK(harness.sent[1].data == (buf_t{ 0x21, 6, 7, 8, 9, 10, 11, 12 }));
+        CHECK_EQUAL(0x22, harness.sent[2].data[0]);
+        CHECK_EQUAL(0u, harness.scheduler.poll()); // the block is used up
+
+        // WAIT keeps the sender waiting without failing
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::WAIT, 0, 0));
+        CHECK_EQUAL(0u, harness.scheduler.poll());
+
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::CONTINUE, 0, 0));
+        CHECK_EQUAL(5u, harness.scheduler.poll()); // BS 0: everything else
+        CHECK(harness.sent.back().data == (buf_t{ 0x27, 48, 49 }));
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.completions.back().result);
+
+        // ABORT fails the message
+        harness.scheduler.enqueue(makeMessage(50), CanId(0x7e0));
+        harness.scheduler.poll();
+        CHECK_EQUAL(ReturnValue::OVERFLOW, harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::ABORT_TRANSMISSION, 0, 0));
+        CHECK_EQUAL(ReturnValue::OVERFLOW, harness.completions.back().result);
+        CHECK_EQUAL(0u, harness.scheduler.getPendingMessages());
+    }
+
+    void sequenceNumbersWrap() {
+        Harness harness;
+
+        // 6 + 20 * 7 bytes: the SN wraps from 15 to 0
+        harness.scheduler.enqueue(makeMessage(146), CanId(0x7e0));
+        harness.scheduler.poll();
+        harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::CONTINUE, 0, 0);
+        CHECK_EQUAL(20u, harness.scheduler.poll());
+
+        for (size_t i = 1; i < harness.sent.size(); i++) { CHECK_EQUAL(0x20 | (i & 0x0f), harness.sent[i].data[0]); }
+    }
+
+    void interleavesPeers() {
+        Harness harness;
+
+        harness.scheduler.enqueue(makeMessage(20), CanId(0x7e1));
+        harness.scheduler.enqueue(makeMessage(20), CanId(0x7e0));
+        CHECK_EQUAL(2u, harness.scheduler.poll()); // both FFs, lower ID first
+        CHECK_EQUAL(0x7e0u, harness.sent[0].canId);
+        CHECK_EQUAL(0x7e1u, harness.sent[1].canId);
+
+        // with an STmin of 1ms, each peer sends one CF per tick, so neither waits for the other to finish
+        harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::CONTINUE, 0, 1);
+        harness.scheduler.handleFlowControlFrame(CanId(0x7e1), FlowControlFlag::CONTINUE, 0, 1);
+        harness.sent.clear();
+
+        for (int tick = 0; tick < 2; tick++) {
+            CHECK_EQUAL(2u, harness.scheduler.poll());
+            harness.now++;
+        }
+
+        CHECK_EQUAL(4u, harness.sent.size());
+        CHECK_EQUAL(0x7e0u, harness.sent[0].canId);
+        CHECK_EQUAL(0x7e1u, harness.sent[1].canId);
+        CHECK_EQUAL(0x7e0u, harness.sent[2].canId);
+        CHECK_EQUAL(0x7e1u, harness.sent[3].canId);
+        CHECK_EQUAL(2u, harness.completions.size());
+
+        // a peer stalled by a large STmin does not hold up the other
+        harness.scheduler.enqueue(makeMessage(30), CanId(0x7e0));
+        harness.scheduler.enqueue(makeMessage(30), CanId(0x7e1));
+        harness.scheduler.poll();
+        harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::CONTINUE, 0, 100);
+        harness.scheduler.handleFlowControlFrame(CanId(0x7e1), FlowControlFlag::CONTINUE, 0, 0);
+        CHECK_EQUAL(5u, harness.scheduler.poll()); // one CF to 0x7e0, all four to 0x7e1
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.completions.back().result);
+        CHECK_EQUAL(0x7e1u, harness.completions.back().canId);
+    }
+
+    void priorityPreempts() {
+        Harness harness;
+
+        harness.scheduler.enqueue(makeMessage(100), CanId(0x700));
+        harness.scheduler.poll();
+        harness.scheduler.handleFlowControlFrame(CanId(0x700), FlowControlFlag::CONTINUE, 0, 1);
+        harness.scheduler.poll();
+
+        // the urgent message overtakes the bulk transfer at the next frame, despite its higher ID
+        harness.now++;
+        harness.sent.clear();
+        harness.scheduler.enqueue(buf_t{ 0x3e, 0x80 }, CanId(0x7ff), 0);
+        CHECK_EQUAL(2u, harness.scheduler.poll());
+        CHECK_EQUAL(0x7ffu, harness.sent[0].canId);
+        CHECK_EQUAL(0x700u, harness.sent[1].canId);
+    }
+
+    void arbitrationOrder() {
+        Harness harness;
+        const CanId extended(0x18da00f1 | CAN_EFF_FLAG); // base ID 0x636
+        const CanId standardAbove(0x637), standardSame(0x636);
+
+        harness.scheduler.enqueue(buf_t{ 0x01 }, standardAbove);
+        harness.scheduler.enqueue(buf_t{ 0x02 }, extended);
+        harness.scheduler.enqueue(buf_t{ 0x03 }, standardSame);
+        CHECK_EQUAL(3u, harness.scheduler.poll());
+
+        // 0x636 beats the extended frame with the same base ID, which beats 0x637
+        CHECK_EQUAL(0x636u, harness.sent[0].canId);
+        CHECK_EQUAL(static_cast<uint32_t>(extended), harness.sent[1].canId);
+        CHECK_EQUAL(0x637u, harness.sent[2].canId);
+    }
+
+    void flowControlTimeout() {
+        Harness harness;
+
+        harness.scheduler.setFlowControlTimeout(milliseconds(100));
+        harness.scheduler.enqueue(makeMessage(20), CanId(0x7e0));
+        harness.scheduler.enqueue(buf_t{ 0x3e, 0x00 }, CanId(0x7e0));
+        CHECK_EQUAL(1u, harness.scheduler.poll());
+
+        harness.now = 99;
+        CHECK_EQUAL(0u, harness.scheduler.poll());
+        CHECK(harness.completions.empty());
+
+        // N_Bs fails the head message; the next one starts right away
+        harness.now = 100;
+        CHECK_EQUAL(1u, harness.scheduler.poll());
+        CHECK_EQUAL(2u, harness.completions.size());
+        CHECK_EQUAL(ReturnValue::TIMEOUT_OCCURRED, harness.completions[0].result);
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.completions[1].result);
+
+        // FC WAIT restarts the timer
+        harness.scheduler.enqueue(makeMessage(20), CanId(0x7e0));
+        harness.scheduler.poll();
+        harness.now = 180;
+        harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::WAIT, 0, 0);
+        harness.now = 250;
+        harness.scheduler.poll();
+        CHECK_EQUAL(2u, harness.completions.size());
+        harness.now = 280;
+        harness.scheduler.poll();
+        CHECK_EQUAL(ReturnValue::TIMEOUT_OCCURRED, harness.completions.back().result);
+    }
+
+    void queueDepth() {
+        Harness harness(2);
+
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.scheduler.enqueue(buf_t{ 0x01 }, CanId(0x7e0)));
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.scheduler.enqueue(buf_t{ 0x02 }, CanId(0x7e0)));
+        CHECK_EQUAL(ReturnValue::BUFFER_FULL, harness.scheduler.enqueue(buf_t{ 0x03 }, CanId(0x7e0)));
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.scheduler.enqueue(buf_t{ 0x04 }, CanId(0x7e1))); // the depth is per peer
+
+        CHECK_EQUAL(3u, harness.scheduler.poll());
+        CHECK_EQUAL(ReturnValue::SUCCESS, harness.scheduler.enqueue(buf_t{ 0x03 }, CanId(0x7e0)));
+    }
+
+    void rateLimiterChargesSentFramesOnly() {
+        Harness harness;
+        const std::shared_ptr<TransmitRateLimiter> limiter(new TransmitRateLimiter(500000));
+        uint64_t micros = 0;
+
+        limiter->setClockCallback([&micros]() { return micros; });
+        limiter->setBandwidthShare(0.5, std::chrono::microseconds(1000));
+        harness.scheduler.setRateLimiter(limiter);
+
+        // frames the bus rejects use up no budget
+        harness.busUp = false;
+        for (uint32_t i = 0; i < 8; i++) { harness.scheduler.enqueue(buf_t{ 0x3e, 0x00 }, CanId(0x700 + i)); }
+        CHECK_EQUAL(8u, harness.scheduler.poll());
+        CHECK_EQUAL(0u, limiter->getEstimator().getTotalFrames());
+
+        // a 3-byte SF takes 170us, so 1ms of burst grants six, the last one into debt
+        harness.busUp = true;
+        for (uint32_t i = 0; i < 8; i++) { harness.scheduler.enqueue(buf_t{ 0x3e, 0x00 }, CanId(0x700 + i)); }
+        CHECK_EQUAL(6u, harness.scheduler.poll());
+        CHECK_EQUAL(6u, limiter->getEstimator().getTotalFrames());
+        CHECK_EQUAL(2u, harness.scheduler.getPendingMessages());
+    }
+
+    void cachedParametersPrepareFirstBlock() {
+        Harness harness;
+        const std::shared_ptr<PeerParameterCache> cache(new PeerParameterCache());
+
+        harness.scheduler.setPeerParameterCache(cache);
+        harness.scheduler.enqueue(makeMessage(50), CanId(0x7e0));
+        harness.scheduler.poll();
+        harness.now = 5;
+        harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::CONTINUE, 4, 0);
+        harness.scheduler.poll();
+
+        PeerParameters parameters{};
+        CHECK(cache->lookup(CanId(0x7e0), harness.now, parameters));
+        CHECK_EQUAL(4, parameters.blockSize);
+        CHECK_EQUAL(5u, parameters.lastResponseTime);
+
+        // the prepared frames are the same as those segmented on demand
+        const vector<Frame> reference = harness.sent;
+        harness.sent.clear();
+        harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::CONTINUE, 0, 0);
+        harness.scheduler.poll();
+        harness.sent.clear();
+
+        harness.scheduler.enqueue(makeMessage(50), CanId(0x7e0));
+        harness.scheduler.poll();
+        harness.scheduler.handleFlowControlFrame(CanId(0x7e0), FlowControlFlag::CONTINUE, 4, 0);
+        harness.scheduler.poll();
+
+        CHECK_EQUAL(reference.size(), harness.sent.size());
+        for (size_t i = 0; i < reference.size() && i < harness.sent.size(); i++) { CHECK(reference[i].data == harness.sent[i].data); }
+    }
+
+}
+
+int main() {
+    singleFrames();
+    blockSizeAndFlowControl();
+    sequenceNumbersWrap();
+    interleavesPeers();
+    priorityPreempts();
+    arbitrationOrder();
+    flowControlTimeout();
+    queueDepth();
+    rateLimiterChargesSentFramesOnly();
+    cachedParametersPrepareFirstBlock();
+
+    return TEST_RESULT();
+}